@@ -0,0 +1,251 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019-2020 Daniil Goncharov <neargye@gmail.com>, Karaev Alexander <akaraevz@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/perf_event.h>)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define BENCH_HAS_PERF_EVENTS 1
+#else
+#define BENCH_HAS_PERF_EVENTS 0
+#endif
+
+namespace bench {
+
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    static_cast<void>(*static_cast<const volatile char*>(static_cast<const volatile void*>(&value)));
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+// Runs 'op(i)' for i in [0, ops) 'repeats' times and returns the best time per call in nanoseconds.
+template <typename Op>
+double ns_per_op(Op&& op, const std::size_t ops, const int repeats = 5) {
+    double best = 0.0;
+    for (int r = 0; r < repeats; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < ops; ++i) {
+            op(i);
+        }
+        const auto stop = std::chrono::steady_clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(ops);
+        best            = (r == 0) ? ns : std::min(best, ns);
+    }
+    return best;
+}
+
+// Hardware counters per call. 'valid' is false where they can't be read, e.g. off Linux, in most containers, or
+// with kernel.perf_event_paranoid > 2. A counter the CPU doesn't have is negative.
+struct counters {
+    bool valid           = false;
+    double cycles        = -1.0;
+    double instructions  = -1.0;
+    double branches      = -1.0;
+    double branch_misses = -1.0;
+    double l1d_misses    = -1.0;
+};
+
+// A perf_event_open group of the counters above, for this thread in user space.
+class perf_events {
+public:
+    perf_events() noexcept {
+#if BENCH_HAS_PERF_EVENTS
+        constexpr std::uint64_t l1d_read_miss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                              | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        const std::pair<std::uint32_t, std::uint64_t> events[count] = {{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS}, {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}, {PERF_TYPE_HW_CACHE, l1d_read_miss}};
+
+        for (int i = 0; i < count; ++i) {
+            perf_event_attr attr{};
+            attr.size           = sizeof(attr);
+            attr.type           = events[i].first;
+            attr.config         = events[i].second;
+            attr.disabled       = fds_[0] == -1 ? 1 : 0; // the group leader starts and stops the whole group
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, fds_[0], 0));
+            if (i == 0 && fds_[0] == -1) {
+                return; // without cycles, nothing else is worth reading
+            }
+            if (fds_[i] != -1) {
+                slots_[i] = members_++;
+            }
+        }
+#endif
+    }
+
+    ~perf_events() {
+#if BENCH_HAS_PERF_EVENTS
+        for (const int fd : fds_) {
+            if (fd != -1) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    perf_events(const perf_events&) = delete;
+    perf_events& operator=(const perf_events&) = delete;
+
+    bool valid() const noexcept {
+        return fds_[0] != -1;
+    }
+
+    void start() noexcept {
+#if BENCH_HAS_PERF_EVENTS
+        if (valid()) {
+            ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif
+    }
+
+    // the counts since start(), divided by 'calls'
+    counters stop(const std::size_t calls) noexcept {
+        counters result;
+#if BENCH_HAS_PERF_EVENTS
+        if (!valid()) {
+            return result;
+        }
+        ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+        // PERF_FORMAT_GROUP: the number of members, the enabled and running times, then one value per member
+        std::uint64_t data[3 + count]{};
+        if (read(fds_[0], data, sizeof(data)) < static_cast<ssize_t>((3 + members_) * sizeof(std::uint64_t))
+            || data[2] == 0) {
+            return result; // never scheduled, e.g. the PMU is taken
+        }
+
+        // the group was multiplexed with other events when it ran for less time than it was enabled
+        const double scale = static_cast<double>(data[1]) / static_cast<double>(data[2]) / static_cast<double>(calls);
+        double* const fields[count] = {
+            &result.cycles, &result.instructions, &result.branches, &result.branch_misses, &result.l1d_misses};
+        for (int i = 0; i < count; ++i) {
+            if (slots_[i] != -1) {
+                *fields[i] = static_cast<double>(data[3 + slots_[i]]) * scale;
+            }
+        }
+        result.valid = true;
+#else
+        static_cast<void>(calls);
+#endif
+        return result;
+    }
+
+    // one group for the whole process, opened on first use
+    static perf_events& instance() {
+        static perf_events events;
+        return events;
+    }
+
+private:
+    static constexpr int count = 5;
+
+    int fds_[count]   = {-1, -1, -1, -1, -1};
+    int slots_[count] = {-1, -1, -1, -1, -1}; // index of the event in the group's read values
+    int members_      = 0;
+};
+
+struct measurement {
+    double ns = 0.0; // per call
+    counters per_call;
+};
+
+// Like ns_per_op, but also reads the hardware counters around each repeat and keeps those of the fastest one.
+template <typename Op>
+measurement measure(Op&& op, const std::size_t ops, const int repeats = 5) {
+    perf_events& events = perf_events::instance();
+
+    measurement best;
+    for (int r = 0; r < repeats; ++r) {
+        events.start();
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < ops; ++i) {
+            op(i);
+        }
+        const auto stop         = std::chrono::steady_clock::now();
+        const counters per_call = events.stop(ops);
+
+        const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(ops);
+        if (r == 0 || ns < best.ns) {
+            best = {ns, per_call};
+        }
+    }
+    return best;
+}
+
+inline void report(const char* name, const double ns) {
+    std::printf("%-40s %8.2f ns/op\n", name, ns);
+}
+
+// 'bytes' is the number of bytes processed per call; bytes per nanosecond are GB/s.
+inline void report(const char* name, const double ns, const double bytes) {
+    std::printf("%-64s %8.2f ns/op %8.3f GB/s\n", name, ns, bytes / ns);
+}
+
+// Adds the instructions per cycle, branch misses per call and their share of all branches, and L1D read misses
+// per call, where the counters could be read.
+inline void report(const char* name, const measurement& m, const double bytes) {
+    const counters& c = m.per_call;
+    if (!c.valid) {
+        report(name, m.ns, bytes);
+        return;
+    }
+
+    // a counter the CPU doesn't have shows as n/a
+    char ipc[16], misses[16], mispredicted[16], l1d[16];
+    const auto field = [](char(&out)[16], const double value, const char* format) {
+        std::snprintf(out, sizeof(out), value >= 0.0 ? format : "n/a", value);
+    };
+    field(ipc, c.instructions >= 0.0 ? c.instructions / c.cycles : -1.0, "%.2f");
+    field(misses, c.branch_misses, "%.2f");
+    field(mispredicted, c.branch_misses >= 0.0 && c.branches > 0.0 ? 100.0 * c.branch_misses / c.branches : -1.0,
+        "%.1f%%");
+    field(l1d, c.l1d_misses, "%.2f");
+
+    std::printf("%-64s %8.2f ns/op %8.3f GB/s %6s IPC %6s br-miss/op %6s mispredicted %6s L1D-miss/op\n", name, m.ns,
+        bytes / m.ns, ipc, misses, mispredicted, l1d);
+}
+
+} // namespace bench
@@ -0,0 +1,151 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019-2020 Daniil Goncharov <neargye@gmail.com>, Karaev Alexander <akaraevz@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// A constexpr workload for the compile-time benchmark (see compile_time_driver.cpp), and a check of its result.
+// Every workload is a single constant evaluation, so the evaluation step limit it needs is its step count:
+//   BENCH_BASELINE   - generates BENCH_COUNT values and formats them with a naive loop
+//   BENCH_TO_CHARS   - generates the values and formats them with nstd::to_chars into a std::array
+//   BENCH_FROM_CHARS - the baseline, then parses the formatted table back with nstd::from_chars
+// so the cost of from_chars is the difference to the baseline.
+
+#include <charconv/charconv.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <type_traits>
+
+#define BENCH_BASELINE 0
+#define BENCH_TO_CHARS 1
+#define BENCH_FROM_CHARS 2
+
+#ifndef BENCH_WORKLOAD
+#define BENCH_WORKLOAD BENCH_TO_CHARS
+#endif
+
+#ifndef BENCH_TYPE
+#define BENCH_TYPE int
+#endif
+
+#ifndef BENCH_BASE
+#define BENCH_BASE 10
+#endif
+
+#ifndef BENCH_COUNT
+#define BENCH_COUNT 10000
+#endif
+
+namespace {
+
+using value_type = BENCH_TYPE;
+
+constexpr int base          = BENCH_BASE;
+constexpr std::size_t count = BENCH_COUNT;
+constexpr std::size_t width = nstd::max_chars_v<value_type, base>;
+
+// values of every length: a 64-bit LCG output shifted right by a random amount, truncated to value_type
+constexpr value_type next_value(std::uint64_t& state) noexcept {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<value_type>((state >> 1) >> (state >> 58));
+}
+
+struct table {
+    std::array<char, count * width> chars{}; // entry i is at i * width
+    std::array<unsigned char, count> lengths{};
+    std::array<value_type, count> values{};
+};
+
+constexpr std::size_t naive_to_chars(char* const first, const value_type value) noexcept {
+    using unsigned_type = std::make_unsigned_t<value_type>;
+
+    unsigned_type magnitude = static_cast<unsigned_type>(value);
+    std::size_t length      = 0;
+    if constexpr (std::is_signed_v<value_type>) {
+        if (value < 0) {
+            magnitude       = static_cast<unsigned_type>(0 - magnitude);
+            first[length++] = '-';
+        }
+    }
+
+    char digits[64]{};
+    std::size_t count_digits = 0;
+    do {
+        digits[count_digits++] = "0123456789abcdefghijklmnopqrstuvwxyz"[magnitude % base];
+        magnitude              = static_cast<unsigned_type>(magnitude / base);
+    } while (magnitude != 0);
+
+    while (count_digits != 0) {
+        first[length++] = digits[--count_digits];
+    }
+    return length;
+}
+
+constexpr table make_table() noexcept {
+    table result{};
+    std::uint64_t state = 42;
+    for (std::size_t i = 0; i < count; ++i) {
+        const value_type value = next_value(state);
+#if BENCH_WORKLOAD == BENCH_TO_CHARS
+        char* const first  = result.chars.data() + i * width;
+        const auto written = nstd::to_chars(first, first + width, value, base);
+        result.lengths[i]  = static_cast<unsigned char>(written.ptr - first);
+#else
+        result.lengths[i] = static_cast<unsigned char>(naive_to_chars(result.chars.data() + i * width, value));
+#endif
+#if BENCH_WORKLOAD != BENCH_FROM_CHARS
+        result.values[i] = value;
+#endif
+    }
+
+#if BENCH_WORKLOAD == BENCH_FROM_CHARS
+    for (std::size_t i = 0; i < count; ++i) {
+        const char* const first = result.chars.data() + i * width;
+        nstd::from_chars(first, first + result.lengths[i], result.values[i], base);
+    }
+#endif
+    return result;
+}
+
+constexpr table evaluated = make_table();
+
+} // namespace
+
+int main() {
+    // The check runs at runtime, so that it adds nothing to the compile time being measured.
+    std::uint64_t state = 42;
+    for (std::size_t i = 0; i < count; ++i) {
+        const value_type value = next_value(state);
+        char expected[64]{};
+        const std::size_t length = naive_to_chars(expected, value);
+
+        bool same = evaluated.values[i] == value && evaluated.lengths[i] == length;
+        for (std::size_t c = 0; same && c < length; ++c) {
+            same = evaluated.chars[i * width + c] == expected[c];
+        }
+        if (!same) {
+            std::printf("entry %zu differs\n", i);
+            return 1;
+        }
+    }
+}
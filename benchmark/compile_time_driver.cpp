@@ -0,0 +1,241 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019-2020 Daniil Goncharov <neargye@gmail.com>, Karaev Alexander <akaraevz@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Compile-time benchmark: compiles compile_time.cpp with the compiler this was built with, once per type and
+// workload, and prints one JSON object per line:
+//   {"compiler": "GNU", "version": "12.2.0", "std": "c++20", "type": "int", "base": 10, "count": 10000,
+//    "workload": "to_chars", "seconds": 0.91, "steps": 6220000}
+// "seconds" is the best wall time of a syntax-only compile out of --repeats. "steps" is the smallest constexpr
+// evaluation limit (-fconstexpr-ops-limit, -fconstexpr-steps, /constexpr:steps) the workload compiles with, found
+// by bisection to within 1%; it is only measured with --steps, and null otherwise or when even the upper limit fails.
+//
+// usage: compile_time [--count N] [--base B] [--repeats R] [--steps] [--output FILE] [--type T]... [--workload W]...
+
+#include <charconv/charconv.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+#if defined(_WIN32)
+constexpr const char* discard_output = " > NUL 2>&1";
+#else
+constexpr const char* discard_output = " > /dev/null 2>&1";
+#endif
+
+constexpr bool is_msvc = std::string_view{COMPILE_TIME_CXX_ID} == "MSVC";
+constexpr bool is_gcc  = std::string_view{COMPILE_TIME_CXX_ID} == "GNU";
+
+struct workload {
+    const char* name;
+    int id; // BENCH_WORKLOAD in compile_time.cpp
+};
+
+constexpr workload workloads[] = {{"baseline", 0}, {"to_chars", 1}, {"from_chars", 2}};
+
+constexpr const char* types[] = {"char", "signed char", "unsigned char", "short", "unsigned short", "int",
+    "unsigned int", "long", "unsigned long", "long long", "unsigned long long"};
+
+constexpr unsigned long long max_steps = 1'000'000'000ULL;
+
+struct options {
+    unsigned long count = 10000;
+    int base            = 10;
+    int repeats         = 3;
+    bool steps          = false;
+    std::string output;
+    std::vector<std::string> types;
+    std::vector<std::string> workloads;
+};
+
+std::string limit_flag(const unsigned long long steps) {
+    const std::string value = std::to_string(steps);
+    if (is_msvc) {
+        return "/constexpr:steps" + value;
+    }
+    if (is_gcc) {
+        return "-fconstexpr-ops-limit=" + value;
+    }
+    return "-fconstexpr-steps=" + value;
+}
+
+std::string command(const options& opts, const char* type, const workload& w, const unsigned long long steps) {
+    std::string cmd = "\"" COMPILE_TIME_CXX "\"";
+    cmd += is_msvc ? " /nologo /Zs /std:" COMPILE_TIME_STD : " -fsyntax-only -std=" COMPILE_TIME_STD;
+    cmd += " " + limit_flag(steps);
+
+    const char* const prefix = is_msvc ? " \"/" : " \"-";
+    cmd += prefix + std::string{"I"} + COMPILE_TIME_INCLUDE_DIR + "\"";
+    cmd += prefix + std::string{"DBENCH_WORKLOAD="} + std::to_string(w.id) + "\"";
+    cmd += prefix + std::string{"DBENCH_TYPE="} + type + "\"";
+    cmd += prefix + std::string{"DBENCH_BASE="} + std::to_string(opts.base) + "\"";
+    cmd += prefix + std::string{"DBENCH_COUNT="} + std::to_string(opts.count) + "\"";
+
+    cmd += " \"" COMPILE_TIME_SOURCE "\"";
+    cmd += discard_output;
+    return cmd;
+}
+
+bool compiles(const std::string& cmd) {
+#if defined(_WIN32)
+    // cmd.exe drops the first and the last quote of a command line that starts with one
+    return std::system(("\"" + cmd + "\"").c_str()) == 0;
+#else
+    return std::system(cmd.c_str()) == 0;
+#endif
+}
+
+// the best wall time out of opts.repeats compiles, or a negative value if the workload does not compile
+double seconds(const options& opts, const char* type, const workload& w) {
+    const std::string cmd = command(opts, type, w, max_steps);
+
+    double best = -1.0;
+    for (int r = 0; r < opts.repeats; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        const bool ok    = compiles(cmd);
+        const auto stop  = std::chrono::steady_clock::now();
+        if (!ok) {
+            return -1.0;
+        }
+
+        const double s = std::chrono::duration<double>(stop - start).count();
+        best           = (best < 0.0) ? s : (s < best ? s : best);
+    }
+    return best;
+}
+
+// the smallest step limit the workload compiles with, to within 1%, or 0 if it needs more than max_steps
+unsigned long long steps(const options& opts, const char* type, const workload& w) {
+    unsigned long long fails = 0;
+    unsigned long long works = max_steps;
+    if (!compiles(command(opts, type, w, works))) {
+        return 0;
+    }
+
+    while (works - fails > works / 100) {
+        const unsigned long long mid = fails + (works - fails) / 2;
+        (compiles(command(opts, type, w, mid)) ? works : fails) = mid;
+    }
+    return works;
+}
+
+bool selected(const std::vector<std::string>& filter, const char* name) {
+    if (filter.empty()) {
+        return true;
+    }
+    for (const auto& f : filter) {
+        if (f == name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool parse_number(const char* text, unsigned long& value) {
+    const auto [ptr, ec] = nstd::from_chars(text, text + std::strlen(text), value);
+    return ec == std::errc{} && *ptr == '\0';
+}
+
+bool parse_options(const int argc, char** const argv, options& opts) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value  = i + 1 < argc;
+        unsigned long number  = 0;
+
+        if (arg == "--steps") {
+            opts.steps = true;
+        } else if (arg == "--count" && has_value && parse_number(argv[++i], number) && number > 0) {
+            opts.count = number;
+        } else if (arg == "--base" && has_value && parse_number(argv[++i], number) && number >= 2 && number <= 36) {
+            opts.base = static_cast<int>(number);
+        } else if (arg == "--repeats" && has_value && parse_number(argv[++i], number) && number > 0) {
+            opts.repeats = static_cast<int>(number);
+        } else if (arg == "--output" && has_value) {
+            opts.output = argv[++i];
+        } else if (arg == "--type" && has_value) {
+            opts.types.emplace_back(argv[++i]);
+        } else if (arg == "--workload" && has_value) {
+            opts.workloads.emplace_back(argv[++i]);
+        } else {
+            std::fprintf(stderr,
+                "usage: %s [--count N] [--base B] [--repeats R] [--steps] [--output FILE] [--type T]... "
+                "[--workload W]...\n",
+                argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    options opts;
+    if (!parse_options(argc, argv, opts)) {
+        return 2;
+    }
+
+    std::FILE* const out = opts.output.empty() ? stdout : std::fopen(opts.output.c_str(), "w");
+    if (out == nullptr) {
+        std::fprintf(stderr, "cannot open %s\n", opts.output.c_str());
+        return 2;
+    }
+
+    bool all_compiled = true;
+    for (const char* type : types) {
+        if (!selected(opts.types, type)) {
+            continue;
+        }
+        for (const workload& w : workloads) {
+            if (!selected(opts.workloads, w.name)) {
+                continue;
+            }
+
+            const double s = seconds(opts, type, w);
+            all_compiled   = all_compiled && s >= 0.0;
+
+            std::string steps_json = "null";
+            if (opts.steps && s >= 0.0) {
+                if (const unsigned long long n = steps(opts, type, w); n != 0) {
+                    steps_json = std::to_string(n);
+                }
+            }
+
+            std::fprintf(out,
+                "{\"compiler\": \"%s\", \"version\": \"%s\", \"std\": \"%s\", \"type\": \"%s\", \"base\": %d, "
+                "\"count\": %lu, \"workload\": \"%s\", \"seconds\": %s, \"steps\": %s}\n",
+                COMPILE_TIME_CXX_ID, COMPILE_TIME_CXX_VERSION, COMPILE_TIME_STD, type, opts.base, opts.count, w.name,
+                s >= 0.0 ? std::to_string(s).c_str() : "null", steps_json.c_str());
+            std::fflush(out);
+        }
+    }
+    if (out != stdout) {
+        std::fclose(out);
+    }
+    return all_compiled ? 0 : 1;
+}
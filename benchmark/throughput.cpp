@@ -0,0 +1,287 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019-2020 Daniil Goncharov <neargye@gmail.com>, Karaev Alexander <akaraevz@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Runtime throughput of nstd::to_chars and nstd::from_chars against std::to_chars/std::from_chars, snprintf and
+// strtoll/strtoull, for every integral type, bases 2, 8, 10, 16 and 36, and several value distributions:
+//   uniform     - uniform over the whole range of the type
+//   small       - magnitudes below 100
+//   log-uniform - uniform bit width, so that every length is equally likely
+//   worst-case  - only values of the longest length in the base
+// GB/s counts the characters written or parsed. snprintf is only measured where it has a conversion for the base
+// and type (%o and %x are for unsigned values). Arguments narrow the rows down: each one must match the type name,
+// the base, or "to_chars"/"from_chars", e.g. `throughput "long long" 10`.
+// On Linux, each row also shows IPC, branch misses and L1D misses per conversion from perf_event_open, when the
+// kernel allows it (kernel.perf_event_paranoid <= 2 for user-space counting of this process).
+
+#include "bench.hpp"
+
+#include <charconv/charconv.hpp>
+
+#include <array>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<charconv>)
+#include <charconv>
+#define THROUGHPUT_HAS_STD_CHARCONV 1
+#else
+#define THROUGHPUT_HAS_STD_CHARCONV 0
+#endif
+
+namespace {
+
+constexpr std::size_t count = 1 << 12;
+constexpr std::size_t ops   = count * 16;
+
+constexpr int bases[] = {2, 8, 10, 16, 36};
+
+enum class distribution { uniform, small, log_uniform, worst_case };
+
+constexpr std::pair<distribution, const char*> distributions[] = {{distribution::uniform, "uniform"},
+    {distribution::small, "small"}, {distribution::log_uniform, "log-uniform"},
+    {distribution::worst_case, "worst-case"}};
+
+std::vector<std::string> filters;
+
+bool selected(const char* direction, const char* type, const int base) {
+    for (const auto& f : filters) {
+        if (f != direction && f != type && f != std::to_string(base)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+std::vector<T> make_values(const distribution dist, const int base) {
+    using U = std::make_unsigned_t<T>;
+
+    std::mt19937_64 gen{42};
+    std::vector<T> values(count);
+
+    // the smallest magnitude of the longest length: base^(length of max - 1)
+    const int max_length = nstd::to_chars_length((std::numeric_limits<T>::max)(), base);
+    U longest            = 1;
+    for (int i = 1; i < max_length; ++i) {
+        longest = static_cast<U>(longest * static_cast<U>(base));
+    }
+
+    for (auto& v : values) {
+        const std::uint64_t raw = gen();
+        switch (dist) {
+        case distribution::uniform:
+            v = static_cast<T>(raw);
+            break;
+        case distribution::small:
+            v = static_cast<T>(raw % 100);
+            if constexpr (std::is_signed_v<T>) {
+                v = (gen() & 1) ? static_cast<T>(-v) : v;
+            }
+            break;
+        case distribution::log_uniform: {
+            const int bits = static_cast<int>(gen() % (std::numeric_limits<U>::digits + 1));
+            v              = static_cast<T>(bits == 0 ? 0 : raw >> (64 - bits));
+            if constexpr (std::is_signed_v<T>) {
+                v = (gen() & 1) ? static_cast<T>(-v) : v;
+            }
+            break;
+        }
+        case distribution::worst_case: {
+            // magnitudes in [longest, max], negated for signed types, so that the sign adds a character
+            const U span = static_cast<U>(static_cast<U>((std::numeric_limits<T>::max)()) - longest);
+            const U magnitude =
+                static_cast<U>(longest + (span == (std::numeric_limits<U>::max)() ? static_cast<U>(raw)
+                                                                                  : static_cast<U>(raw % (span + 1U))));
+            v = static_cast<T>(magnitude);
+            if constexpr (std::is_signed_v<T>) {
+                v = static_cast<T>(-v);
+            }
+            break;
+        }
+        }
+    }
+    return values;
+}
+
+// the values formatted with nstd::to_chars, each NUL terminated for strtoll
+struct texts {
+    std::vector<char> chars;
+    std::vector<std::size_t> offsets; // text i is [offsets[i], offsets[i + 1] - 1)
+};
+
+template <typename T>
+texts make_texts(const std::vector<T>& values, const int base) {
+    texts result;
+    result.offsets.push_back(0);
+    for (const T v : values) {
+        std::array<char, 72> buff{};
+        const auto res = nstd::to_chars(buff.data(), buff.data() + buff.size(), v, base);
+        result.chars.insert(result.chars.end(), buff.data(), res.ptr);
+        result.chars.push_back('\0');
+        result.offsets.push_back(result.chars.size());
+    }
+    return result;
+}
+
+void report(const char* direction, const char* type, const int base, const char* dist, const char* impl,
+    const bench::measurement& m, const double chars_per_op) {
+    char name[96];
+    std::snprintf(name, sizeof(name), "%s %s, base %d, %s: %s", direction, type, base, dist, impl);
+    bench::report(name, m, chars_per_op);
+}
+
+template <typename T>
+void run_to_chars(const char* type, const int base, const char* dist, const std::vector<T>& values,
+    const double chars_per_op) {
+    std::array<char, 72> buff{};
+
+    const auto measure = [&](const char* impl, auto&& convert) {
+        const bench::measurement m = bench::measure(
+            [&](const std::size_t i) {
+                const auto res = convert(values[i % count]);
+                bench::do_not_optimize(res);
+                bench::do_not_optimize(buff);
+            },
+            ops);
+        report("to_chars", type, base, dist, impl, m, chars_per_op);
+    };
+
+    measure("nstd::to_chars",
+        [&](const T v) { return nstd::to_chars(buff.data(), buff.data() + buff.size(), v, base).ptr; });
+
+#if THROUGHPUT_HAS_STD_CHARCONV
+    measure("std::to_chars", [&](const T v) { return std::to_chars(buff.data(), buff.data() + buff.size(), v, base).ptr; });
+#endif
+
+    if (base == 10) {
+        if constexpr (std::is_signed_v<T>) {
+            measure("snprintf", [&](const T v) {
+                return std::snprintf(buff.data(), buff.size(), "%" PRIdMAX, static_cast<std::intmax_t>(v));
+            });
+        } else {
+            measure("snprintf", [&](const T v) {
+                return std::snprintf(buff.data(), buff.size(), "%" PRIuMAX, static_cast<std::uintmax_t>(v));
+            });
+        }
+    } else if (std::is_unsigned_v<T> && (base == 8 || base == 16)) {
+        const char* const format = base == 8 ? "%" PRIoMAX : "%" PRIxMAX;
+        measure("snprintf", [&](const T v) {
+            return std::snprintf(buff.data(), buff.size(), format, static_cast<std::uintmax_t>(v));
+        });
+    }
+}
+
+template <typename T>
+void run_from_chars(const char* type, const int base, const char* dist, const texts& text, const double chars_per_op) {
+    const auto measure = [&](const char* impl, auto&& convert) {
+        const bench::measurement m = bench::measure(
+            [&](const std::size_t i) {
+                const std::size_t idx = i % count;
+                const char* const first = text.chars.data() + text.offsets[idx];
+                const char* const last  = text.chars.data() + text.offsets[idx + 1] - 1;
+                const auto res          = convert(first, last);
+                bench::do_not_optimize(res);
+            },
+            ops);
+        report("from_chars", type, base, dist, impl, m, chars_per_op);
+    };
+
+    measure("nstd::from_chars", [&](const char* first, const char* last) {
+        T value{};
+        nstd::from_chars(first, last, value, base);
+        return value;
+    });
+
+#if THROUGHPUT_HAS_STD_CHARCONV
+    measure("std::from_chars", [&](const char* first, const char* last) {
+        T value{};
+        std::from_chars(first, last, value, base);
+        return value;
+    });
+#endif
+
+    if constexpr (std::is_signed_v<T>) {
+        measure("strtoll", [&](const char* first, const char*) { return std::strtoll(first, nullptr, base); });
+    } else {
+        measure("strtoull", [&](const char* first, const char*) { return std::strtoull(first, nullptr, base); });
+    }
+}
+
+template <typename T>
+void run(const char* type) {
+    for (const int base : bases) {
+        const bool to   = selected("to_chars", type, base);
+        const bool from = selected("from_chars", type, base);
+        if (!to && !from) {
+            continue;
+        }
+
+        for (const auto& [dist, dist_name] : distributions) {
+            const auto values = make_values<T>(dist, base);
+            const texts text  = make_texts(values, base);
+
+            // every text has a terminating NUL that isn't part of it
+            const double chars_per_op = static_cast<double>(text.chars.size() - count) / static_cast<double>(count);
+
+            if (to) {
+                run_to_chars(type, base, dist_name, values, chars_per_op);
+            }
+            if (from) {
+                run_from_chars<T>(type, base, dist_name, text, chars_per_op);
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    filters.assign(argv + 1, argv + argc);
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__OPTIMIZE__)
+    // make_benchmark adds -O2; this catches builds of the file that bypass it
+    std::fprintf(stderr, "warning: built without optimization, the comparison with the baselines is meaningless\n");
+#endif
+
+    if (!bench::perf_events::instance().valid()) {
+        std::fprintf(stderr, "hardware counters unavailable, reporting times only\n");
+    }
+
+    run<char>("char");
+    run<signed char>("signed char");
+    run<unsigned char>("unsigned char");
+    run<short>("short");
+    run<unsigned short>("unsigned short");
+    run<int>("int");
+    run<unsigned int>("unsigned int");
+    run<long>("long");
+    run<unsigned long>("unsigned long");
+    run<long long>("long long");
+    run<unsigned long long>("unsigned long long");
+}
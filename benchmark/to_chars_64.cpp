@@ -0,0 +1,84 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019-2020 Daniil Goncharov <neargye@gmail.com>, Karaev Alexander <akaraevz@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Base-10 to_chars for 64-bit values. Values above 2^32 take the 9-digit chunk path on 32-bit targets,
+// so build this with -m32 (CHARCONV_OPT_BUILD_M32) to measure it.
+
+#include "bench.hpp"
+
+#include <charconv/charconv.hpp>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+template <typename T>
+std::vector<T> make_values(const std::size_t count, const std::uint64_t min, const std::uint64_t max) {
+    std::mt19937_64 gen{42};
+    std::uniform_int_distribution<std::uint64_t> dist{min, max};
+
+    std::vector<T> values(count);
+    for (auto& v : values) {
+        v = static_cast<T>(dist(gen));
+        if constexpr (std::is_signed_v<T>) {
+            if (gen() & 1) {
+                v = static_cast<T>(-v);
+            }
+        }
+    }
+    return values;
+}
+
+template <typename T>
+void run(const char* name, const std::uint64_t min, const std::uint64_t max) {
+    constexpr std::size_t count = 1 << 16;
+    const auto values           = make_values<T>(count, min, max);
+    std::array<char, 32> buf{};
+
+    const double ns = bench::ns_per_op(
+        [&](const std::size_t i) {
+            const auto res = nstd::to_chars(buf.data(), buf.data() + buf.size(), values[i % count]);
+            bench::do_not_optimize(res);
+            bench::do_not_optimize(buf);
+        },
+        count * 16);
+
+    bench::report(name, ns);
+}
+
+} // namespace
+
+int main() {
+    std::printf("sizeof(void*) = %zu\n", sizeof(void*));
+
+    constexpr std::uint64_t below_2_32 = UINT32_MAX;
+    constexpr std::uint64_t above_2_32 = std::uint64_t{1} << 32;
+
+    run<unsigned long long>("unsigned long long, < 2^32", 0, below_2_32);
+    run<unsigned long long>("unsigned long long, >= 2^32", above_2_32, UINT64_MAX);
+    run<long long>("long long, |v| < 2^32", 0, below_2_32);
+    run<long long>("long long, |v| >= 2^32", above_2_32, INT64_MAX);
+}
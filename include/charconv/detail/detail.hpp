@@ -29,15 +29,30 @@
 // * change _Adl_verify_range to assert
 // * change _STL_ASSERT to assert
 // * change _STL_INTERNAL_CHECK to assert
+// * add '_Digit_pairs' table
+// * add '_Countl_zero', '_Countr_zero', '_Bit_width' and '_Pow10' bit helpers
+// * add '_Integer_length'
+// * add '_Umul128_high' and '_Div1e9' (Ryu's division workaround for 32-bit platforms)
+// * add 'NSTD_CHARCONV_CONSTEVAL'
+// * add the '_Digit_counts' table, so that '_Integer_length' takes constant time in every base
 
 #pragma once
 
 #include <cassert>
+#include <cstddef>
 #include <iterator>
+#include <limits>
+#include <type_traits>
 
 #undef _NODISCARD
 #define _NODISCARD [[nodiscard]]
 
+#if defined(__cpp_consteval)
+#define NSTD_CHARCONV_CONSTEVAL consteval
+#else
+#define NSTD_CHARCONV_CONSTEVAL constexpr
+#endif
+
 #define nstd_verify_range(_First, _Last) assert(_First <= _Last)
 #define nstd_assert(_Cond) assert(_Cond)
 #define nstd_assert_msg(_Cond, _Msg) assert(_Cond)
@@ -48,6 +63,183 @@ inline constexpr char _Charconv_digits[] = {'0', '1', '2', '3', '4', '5', '6', '
                                             'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z'};
 static_assert(std::size(_Charconv_digits) == 36);
 
+// '00', '01', ..., '99' for emitting two decimal digits per division
+inline constexpr char _Digit_pairs[] = {
+    '0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6', '0', '7', '0', '8', '0', '9',
+    '1', '0', '1', '1', '1', '2', '1', '3', '1', '4', '1', '5', '1', '6', '1', '7', '1', '8', '1', '9',
+    '2', '0', '2', '1', '2', '2', '2', '3', '2', '4', '2', '5', '2', '6', '2', '7', '2', '8', '2', '9',
+    '3', '0', '3', '1', '3', '2', '3', '3', '3', '4', '3', '5', '3', '6', '3', '7', '3', '8', '3', '9',
+    '4', '0', '4', '1', '4', '2', '4', '3', '4', '4', '4', '5', '4', '6', '4', '7', '4', '8', '4', '9',
+    '5', '0', '5', '1', '5', '2', '5', '3', '5', '4', '5', '5', '5', '6', '5', '7', '5', '8', '5', '9',
+    '6', '0', '6', '1', '6', '2', '6', '3', '6', '4', '6', '5', '6', '6', '6', '7', '6', '8', '6', '9',
+    '7', '0', '7', '1', '7', '2', '7', '3', '7', '4', '7', '5', '7', '6', '7', '7', '7', '8', '7', '9',
+    '8', '0', '8', '1', '8', '2', '8', '3', '8', '4', '8', '5', '8', '6', '8', '7', '8', '8', '8', '9',
+    '9', '0', '9', '1', '9', '2', '9', '3', '9', '4', '9', '5', '9', '6', '9', '7', '9', '8', '9', '9'};
+static_assert(std::size(_Digit_pairs) == 200);
+
+inline constexpr unsigned long long _Pow10[] = {1ULL, 10ULL, 100ULL, 1'000ULL, 10'000ULL, 100'000ULL, 1'000'000ULL,
+    10'000'000ULL, 100'000'000ULL, 1'000'000'000ULL, 10'000'000'000ULL, 100'000'000'000ULL, 1'000'000'000'000ULL,
+    10'000'000'000'000ULL, 100'000'000'000'000ULL, 1'000'000'000'000'000ULL, 10'000'000'000'000'000ULL,
+    100'000'000'000'000'000ULL, 1'000'000'000'000'000'000ULL, 10'000'000'000'000'000'000ULL};
+static_assert(std::size(_Pow10) == 20);
+
+_NODISCARD constexpr unsigned long long _Umul128_high(const unsigned long long _Left, const unsigned long long _Right) noexcept {
+    // high half of the 128-bit product, built from 32x32->64 multiplications (Ryu's umul128)
+    const unsigned long long _Left_lo  = _Left & 0xFFFF'FFFFU;
+    const unsigned long long _Left_hi  = _Left >> 32;
+    const unsigned long long _Right_lo = _Right & 0xFFFF'FFFFU;
+    const unsigned long long _Right_hi = _Right >> 32;
+
+    const unsigned long long _B00 = _Left_lo * _Right_lo;
+    const unsigned long long _B01 = _Left_lo * _Right_hi;
+    const unsigned long long _B10 = _Left_hi * _Right_lo;
+    const unsigned long long _B11 = _Left_hi * _Right_hi;
+
+    const unsigned long long _Mid1 = _B10 + (_B00 >> 32);
+    const unsigned long long _Mid2 = _B01 + (_Mid1 & 0xFFFF'FFFFU);
+
+    return _B11 + (_Mid1 >> 32) + (_Mid2 >> 32);
+}
+
+_NODISCARD constexpr unsigned long long _Div1e9(const unsigned long long _Val) noexcept {
+    // _Val / 1'000'000'000 for every 64-bit _Val, without calling the 64-bit division helper. Dropping the nine
+    // factors of two in 10^9 first is what makes Ryu's reciprocal exact over the whole range.
+    return _Umul128_high(_Val >> 9, 0x44B8'2FA0'9B5A'53U) >> 11;
+}
+
+template <class _UInt>
+_NODISCARD constexpr int _Countl_zero(_UInt _Val) noexcept {
+    static_assert(std::is_unsigned_v<_UInt>);
+    constexpr int _Digits = std::numeric_limits<_UInt>::digits;
+
+#if defined(__GNUC__) || defined(__clang__)
+    if (_Val == 0) {
+        return _Digits;
+    }
+
+    if constexpr (_Digits <= std::numeric_limits<unsigned int>::digits) {
+        return __builtin_clz(_Val) - (std::numeric_limits<unsigned int>::digits - _Digits);
+    } else {
+        return __builtin_clzll(_Val);
+    }
+#else
+    int _Count = _Digits;
+    for (int _Shift = _Digits / 2; _Shift != 0; _Shift /= 2) {
+        const _UInt _Upper = static_cast<_UInt>(_Val >> _Shift);
+        if (_Upper != 0) {
+            _Count -= _Shift;
+            _Val = _Upper;
+        }
+    }
+    return _Count - static_cast<int>(_Val);
+#endif
+}
+
+template <class _UInt>
+_NODISCARD constexpr int _Countr_zero(_UInt _Val) noexcept {
+    static_assert(std::is_unsigned_v<_UInt>);
+    constexpr int _Digits = std::numeric_limits<_UInt>::digits;
+
+    if (_Val == 0) {
+        return _Digits;
+    }
+
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (_Digits <= std::numeric_limits<unsigned int>::digits) {
+        return __builtin_ctz(_Val);
+    } else {
+        return __builtin_ctzll(_Val);
+    }
+#else
+    int _Count = 0;
+    while ((_Val & 1U) == 0) {
+        ++_Count;
+        _Val >>= 1;
+    }
+    return _Count;
+#endif
+}
+
+template <class _UInt>
+_NODISCARD constexpr int _Bit_width(const _UInt _Val) noexcept {
+    return std::numeric_limits<_UInt>::digits - _Countl_zero(_Val);
+}
+
+_NODISCARD constexpr std::size_t _Count_digit_powers() noexcept {
+    std::size_t _Count = 0;
+    for (unsigned long long _Base = 2; _Base <= 36; ++_Base) {
+        for (unsigned long long _Pow = 1;; _Pow *= _Base) {
+            ++_Count;
+            if (_Pow > 0xFFFF'FFFF'FFFF'FFFFU / _Base) {
+                break;
+            }
+        }
+    }
+    return _Count;
+}
+
+inline constexpr std::size_t _Digit_power_count = _Count_digit_powers();
+
+struct _Digit_count_table {
+    unsigned long long _Powers[_Digit_power_count]; // base^0, base^1, ... while they fit in 64 bits, for every base
+    unsigned short _First_power[38]; // base^k is _Powers[_First_power[base] + k], the powers end at _First_power[base + 1]
+    unsigned char _Bit_width_digits[37][65]; // digit count of 2^(bit width - 1) in every base
+};
+
+_NODISCARD constexpr _Digit_count_table _Make_digit_count_table() noexcept {
+    _Digit_count_table _Table{};
+    unsigned short _Next = 0;
+    for (unsigned int _Base = 2; _Base <= 36; ++_Base) {
+        const unsigned short _First = _Next;
+        _Table._First_power[_Base]  = _First;
+
+        for (unsigned long long _Pow = 1;; _Pow *= _Base) {
+            _Table._Powers[_Next++] = _Pow;
+            if (_Pow > 0xFFFF'FFFF'FFFF'FFFFU / _Base) {
+                break;
+            }
+        }
+
+        int _Digits = 1;
+        for (int _Width = 1; _Width <= 64; ++_Width) {
+            const unsigned long long _Lowest = 1ULL << (_Width - 1);
+            while (_First + _Digits < _Next && _Lowest >= _Table._Powers[_First + _Digits]) {
+                ++_Digits;
+            }
+            _Table._Bit_width_digits[_Base][_Width] = static_cast<unsigned char>(_Digits);
+        }
+    }
+    _Table._First_power[37] = _Next;
+    return _Table;
+}
+
+inline constexpr _Digit_count_table _Digit_counts = _Make_digit_count_table();
+
+// _Base is the base when it is known at compile time,
+// or 0 when it is only known at run time and passed in _Dynamic_base.
+template <int _Base, class _Unsigned>
+_NODISCARD constexpr int _Integer_length(const _Unsigned _Value, [[maybe_unused]] const int _Dynamic_base = _Base) noexcept {
+    // number of digits needed to represent _Value in _Base, computed without formatting it
+    const _Unsigned _Nonzero = static_cast<_Unsigned>(_Value | 1);
+
+    if constexpr (_Base == 10) {
+        // floor(log10(2) * bit_width) is either the digit count or one less than it
+        const int _Approx = _Bit_width(_Nonzero) * 1233 >> 12;
+        return _Approx + static_cast<int>(_Nonzero >= _Pow10[_Approx]);
+    } else if constexpr (_Base != 0 && (_Base & (_Base - 1)) == 0) {
+        constexpr int _Bits_per_digit = _Bit_width(static_cast<unsigned int>(_Base)) - 1;
+        return (_Bit_width(_Nonzero) + _Bits_per_digit - 1) / _Bits_per_digit;
+    } else {
+        const int _Base_value = _Base != 0 ? _Base : _Dynamic_base;
+
+        // A value has as many digits as the lowest value of its bit width, or one more once it reaches the next power.
+        const int _Len        = _Digit_counts._Bit_width_digits[_Base_value][_Bit_width(_Nonzero)];
+        const int _Next_power = _Digit_counts._First_power[_Base_value] + _Len;
+        return _Len + static_cast<int>(_Next_power < _Digit_counts._First_power[_Base_value + 1]
+                                       && _Value >= _Digit_counts._Powers[_Next_power]);
+    }
+}
+
 _NODISCARD constexpr unsigned char _Digit_from_char(const char _Ch) noexcept {
     // convert ['0', '9'] ['A', 'Z'] ['a', 'z'] to [0, 35], everything else to 255
     constexpr unsigned char _Digit_from_byte[] = {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
@@ -0,0 +1,72 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019-2020 Daniil Goncharov <neargye@gmail.com>, Karaev Alexander <akaraevz@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Instruction sets available to the runtime kernels. These are chosen at compile time from the target flags
+// (-msse4.1, -mavx2, /arch:AVX2, ...); define NSTD_CHARCONV_NO_SIMD to always use the portable loops.
+
+#pragma once
+
+#if !defined(NSTD_CHARCONV_NO_SIMD)
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NSTD_CHARCONV_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__SSSE3__) || defined(__AVX__)
+#define NSTD_CHARCONV_SSSE3 1
+#include <tmmintrin.h>
+#endif
+
+#if defined(__SSE4_1__) || defined(__AVX__)
+#define NSTD_CHARCONV_SSE41 1
+#include <smmintrin.h>
+#endif
+
+#if defined(__BMI2__)
+#define NSTD_CHARCONV_BMI2 1
+#include <immintrin.h>
+#endif
+
+#endif // !NSTD_CHARCONV_NO_SIMD
+
+#if defined(_WIN32) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define NSTD_CHARCONV_LITTLE_ENDIAN 1
+#else
+#define NSTD_CHARCONV_LITTLE_ENDIAN 0
+#endif
+
+#if !defined(NSTD_CHARCONV_SSE2)
+#define NSTD_CHARCONV_SSE2 0
+#endif
+
+#if !defined(NSTD_CHARCONV_SSSE3)
+#define NSTD_CHARCONV_SSSE3 0
+#endif
+
+#if !defined(NSTD_CHARCONV_SSE41)
+#define NSTD_CHARCONV_SSE41 0
+#endif
+
+#if !defined(NSTD_CHARCONV_BMI2)
+#define NSTD_CHARCONV_BMI2 0
+#endif
@@ -25,9 +25,19 @@
 
 // Changes:
 // * add constexpr modifiers to 'to_chars' and 'from_chars'
+// * add 'to_chars' and 'from_chars' overloads taking the base as a template argument
+// * add 'to_chars_length' and 'max_chars_v'
+// * add 'to_chars_array'
+// * add 'to_chars_unchecked' and 'from_chars_unchecked'
+// * add 'from_chars_padded' and 'from_chars_padding'
+// * add 'from_chars_fixed'
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
 #include "charconv/detail/entity.hpp"
 
 #include "integral_to_chars.hpp"
@@ -71,6 +81,122 @@ constexpr to_chars_result to_chars(char* const _First, char* const _Last, const
 
 to_chars_result to_chars(char* _First, char* _Last, const bool _Value, const int _Base = 10) = delete;
 
+// Overloads with the base as a template argument, e.g. to_chars<16>(first, last, value).
+template <int _Base>
+constexpr to_chars_result to_chars(char* const _First, char* const _Last, const char _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in to_chars()");
+    return _Integer_to_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr to_chars_result to_chars(char* const _First, char* const _Last, const signed char _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in to_chars()");
+    return _Integer_to_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr to_chars_result to_chars(char* const _First, char* const _Last, const unsigned char _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in to_chars()");
+    return _Integer_to_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr to_chars_result to_chars(char* const _First, char* const _Last, const short _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in to_chars()");
+    return _Integer_to_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr to_chars_result to_chars(char* const _First, char* const _Last, const unsigned short _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in to_chars()");
+    return _Integer_to_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr to_chars_result to_chars(char* const _First, char* const _Last, const int _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in to_chars()");
+    return _Integer_to_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr to_chars_result to_chars(char* const _First, char* const _Last, const unsigned int _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in to_chars()");
+    return _Integer_to_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr to_chars_result to_chars(char* const _First, char* const _Last, const long _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in to_chars()");
+    return _Integer_to_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr to_chars_result to_chars(char* const _First, char* const _Last, const unsigned long _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in to_chars()");
+    return _Integer_to_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr to_chars_result to_chars(char* const _First, char* const _Last, const long long _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in to_chars()");
+    return _Integer_to_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr to_chars_result to_chars(char* const _First, char* const _Last, const unsigned long long _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in to_chars()");
+    return _Integer_to_chars<_Base>(_First, _Last, _Value);
+}
+
+template <int _Base>
+to_chars_result to_chars(char* _First, char* _Last, const bool _Value) = delete;
+
+// Exact number of characters to_chars(first, last, value, base) writes on success, sign included.
+constexpr int to_chars_length(const char _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_length(_Value, _Base);
+}
+constexpr int to_chars_length(const signed char _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_length(_Value, _Base);
+}
+constexpr int to_chars_length(const unsigned char _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_length(_Value, _Base);
+}
+constexpr int to_chars_length(const short _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_length(_Value, _Base);
+}
+constexpr int to_chars_length(const unsigned short _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_length(_Value, _Base);
+}
+constexpr int to_chars_length(const int _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_length(_Value, _Base);
+}
+constexpr int to_chars_length(const unsigned int _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_length(_Value, _Base);
+}
+constexpr int to_chars_length(const long _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_length(_Value, _Base);
+}
+constexpr int to_chars_length(const unsigned long _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_length(_Value, _Base);
+}
+constexpr int to_chars_length(const long long _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_length(_Value, _Base);
+}
+constexpr int to_chars_length(const unsigned long long _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_length(_Value, _Base);
+}
+
+int to_chars_length(const bool _Value, const int _Base = 10) = delete;
+
+// Largest to_chars_length of any _Ty value in _Base, for sizing buffers.
+template <class _Ty, int _Base = 10>
+inline constexpr int max_chars_v = _Integer_to_chars_max_length<_Ty, _Base>();
+
+// _Value formatted in _Base at compile time, as exactly to_chars_length(_Value, _Base) characters without a null
+// terminator, e.g. to_chars_array<-42>() is {'-', '4', '2'}.
+template <auto _Value, int _Base = 10>
+_NODISCARD NSTD_CHARCONV_CONSTEVAL std::array<char, _Integer_to_chars_length<_Base>(_Value)> to_chars_array() noexcept {
+    static_assert(std::is_integral_v<decltype(_Value)> && !std::is_same_v<decltype(_Value), bool>,
+        "to_chars_array requires an integral value other than bool");
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in to_chars_array()");
+
+    std::array<char, _Integer_to_chars_length<_Base>(_Value)> _Result{};
+    const to_chars_result _Res = _Integer_to_chars<_Base>(_Result.data(), _Result.data() + _Result.size(), _Value);
+    nstd_assert(_Res.ec == errc{} && _Res.ptr == _Result.data() + _Result.size());
+    static_cast<void>(_Res);
+    return _Result;
+}
+
 constexpr from_chars_result from_chars(const char* const _First, const char* const _Last, char& _Value, const int _Base = 10) noexcept {
     return _Integer_from_chars(_First, _Last, _Value, _Base);
 }
@@ -107,4 +233,233 @@ constexpr from_chars_result from_chars(const char* const _First, const char* con
 
 from_chars_result from_chars(const char* _First, const char* _Last, bool& _Value, const int _Base = 10) = delete;
 
+// from_chars for input followed by at least from_chars_padding readable bytes past last (e.g. a padded network buffer
+// or memory-mapped file), so that the runtime kernels can use full-width loads instead of handling the tail.
+// The bytes past last are never parsed.
+inline constexpr std::size_t from_chars_padding = _From_chars_padding;
+
+constexpr from_chars_result from_chars_padded(const char* const _First, const char* const _Last, char& _Value, const int _Base = 10) noexcept {
+    return _Integer_from_chars_padded(_First, _Last, _Value, _Base);
+}
+constexpr from_chars_result from_chars_padded(const char* const _First, const char* const _Last, signed char& _Value, const int _Base = 10) noexcept {
+    return _Integer_from_chars_padded(_First, _Last, _Value, _Base);
+}
+constexpr from_chars_result from_chars_padded(const char* const _First, const char* const _Last, unsigned char& _Value, const int _Base = 10) noexcept {
+    return _Integer_from_chars_padded(_First, _Last, _Value, _Base);
+}
+constexpr from_chars_result from_chars_padded(const char* const _First, const char* const _Last, short& _Value, const int _Base = 10) noexcept {
+    return _Integer_from_chars_padded(_First, _Last, _Value, _Base);
+}
+constexpr from_chars_result from_chars_padded(const char* const _First, const char* const _Last, unsigned short& _Value, const int _Base = 10) noexcept {
+    return _Integer_from_chars_padded(_First, _Last, _Value, _Base);
+}
+constexpr from_chars_result from_chars_padded(const char* const _First, const char* const _Last, int& _Value, const int _Base = 10) noexcept {
+    return _Integer_from_chars_padded(_First, _Last, _Value, _Base);
+}
+constexpr from_chars_result from_chars_padded(const char* const _First, const char* const _Last, unsigned int& _Value, const int _Base = 10) noexcept {
+    return _Integer_from_chars_padded(_First, _Last, _Value, _Base);
+}
+constexpr from_chars_result from_chars_padded(const char* const _First, const char* const _Last, long& _Value, const int _Base = 10) noexcept {
+    return _Integer_from_chars_padded(_First, _Last, _Value, _Base);
+}
+constexpr from_chars_result from_chars_padded(const char* const _First, const char* const _Last, unsigned long& _Value, const int _Base = 10) noexcept {
+    return _Integer_from_chars_padded(_First, _Last, _Value, _Base);
+}
+constexpr from_chars_result from_chars_padded(const char* const _First, const char* const _Last, long long& _Value, const int _Base = 10) noexcept {
+    return _Integer_from_chars_padded(_First, _Last, _Value, _Base);
+}
+constexpr from_chars_result from_chars_padded(const char* const _First, const char* const _Last, unsigned long long& _Value, const int _Base = 10) noexcept {
+    return _Integer_from_chars_padded(_First, _Last, _Value, _Base);
+}
+
+from_chars_result from_chars_padded(const char* _First, const char* _Last, bool& _Value, const int _Base = 10) = delete;
+
+// Parses a fixed-width decimal field of exactly _Digits (1 to 19) digits, leading zeros included, e.g.
+// from_chars_fixed<4>(first, last, year) for the "2020" of "2020-01-31". Fails with invalid_argument unless
+// [first, first + _Digits) are all digits.
+template <std::size_t _Digits>
+constexpr from_chars_result from_chars_fixed(const char* const _First, const char* const _Last, char& _Value) noexcept {
+    return _Integer_from_chars_fixed<_Digits>(_First, _Last, _Value);
+}
+template <std::size_t _Digits>
+constexpr from_chars_result from_chars_fixed(const char* const _First, const char* const _Last, signed char& _Value) noexcept {
+    return _Integer_from_chars_fixed<_Digits>(_First, _Last, _Value);
+}
+template <std::size_t _Digits>
+constexpr from_chars_result from_chars_fixed(const char* const _First, const char* const _Last, unsigned char& _Value) noexcept {
+    return _Integer_from_chars_fixed<_Digits>(_First, _Last, _Value);
+}
+template <std::size_t _Digits>
+constexpr from_chars_result from_chars_fixed(const char* const _First, const char* const _Last, short& _Value) noexcept {
+    return _Integer_from_chars_fixed<_Digits>(_First, _Last, _Value);
+}
+template <std::size_t _Digits>
+constexpr from_chars_result from_chars_fixed(const char* const _First, const char* const _Last, unsigned short& _Value) noexcept {
+    return _Integer_from_chars_fixed<_Digits>(_First, _Last, _Value);
+}
+template <std::size_t _Digits>
+constexpr from_chars_result from_chars_fixed(const char* const _First, const char* const _Last, int& _Value) noexcept {
+    return _Integer_from_chars_fixed<_Digits>(_First, _Last, _Value);
+}
+template <std::size_t _Digits>
+constexpr from_chars_result from_chars_fixed(const char* const _First, const char* const _Last, unsigned int& _Value) noexcept {
+    return _Integer_from_chars_fixed<_Digits>(_First, _Last, _Value);
+}
+template <std::size_t _Digits>
+constexpr from_chars_result from_chars_fixed(const char* const _First, const char* const _Last, long& _Value) noexcept {
+    return _Integer_from_chars_fixed<_Digits>(_First, _Last, _Value);
+}
+template <std::size_t _Digits>
+constexpr from_chars_result from_chars_fixed(const char* const _First, const char* const _Last, unsigned long& _Value) noexcept {
+    return _Integer_from_chars_fixed<_Digits>(_First, _Last, _Value);
+}
+template <std::size_t _Digits>
+constexpr from_chars_result from_chars_fixed(const char* const _First, const char* const _Last, long long& _Value) noexcept {
+    return _Integer_from_chars_fixed<_Digits>(_First, _Last, _Value);
+}
+template <std::size_t _Digits>
+constexpr from_chars_result from_chars_fixed(const char* const _First, const char* const _Last, unsigned long long& _Value) noexcept {
+    return _Integer_from_chars_fixed<_Digits>(_First, _Last, _Value);
+}
+
+template <std::size_t _Digits>
+from_chars_result from_chars_fixed(const char* _First, const char* _Last, bool& _Value) = delete;
+
+// Overloads with the base as a template argument, e.g. from_chars<16>(first, last, value).
+template <int _Base>
+constexpr from_chars_result from_chars(const char* const _First, const char* const _Last, char& _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in from_chars()");
+    return _Integer_from_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr from_chars_result from_chars(const char* const _First, const char* const _Last, signed char& _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in from_chars()");
+    return _Integer_from_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr from_chars_result from_chars(const char* const _First, const char* const _Last, unsigned char& _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in from_chars()");
+    return _Integer_from_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr from_chars_result from_chars(const char* const _First, const char* const _Last, short& _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in from_chars()");
+    return _Integer_from_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr from_chars_result from_chars(const char* const _First, const char* const _Last, unsigned short& _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in from_chars()");
+    return _Integer_from_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr from_chars_result from_chars(const char* const _First, const char* const _Last, int& _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in from_chars()");
+    return _Integer_from_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr from_chars_result from_chars(const char* const _First, const char* const _Last, unsigned int& _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in from_chars()");
+    return _Integer_from_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr from_chars_result from_chars(const char* const _First, const char* const _Last, long& _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in from_chars()");
+    return _Integer_from_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr from_chars_result from_chars(const char* const _First, const char* const _Last, unsigned long& _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in from_chars()");
+    return _Integer_from_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr from_chars_result from_chars(const char* const _First, const char* const _Last, long long& _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in from_chars()");
+    return _Integer_from_chars<_Base>(_First, _Last, _Value);
+}
+template <int _Base>
+constexpr from_chars_result from_chars(const char* const _First, const char* const _Last, unsigned long long& _Value) noexcept {
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in from_chars()");
+    return _Integer_from_chars<_Base>(_First, _Last, _Value);
+}
+
+template <int _Base>
+from_chars_result from_chars(const char* _First, const char* _Last, bool& _Value) = delete;
+
+// Unchecked variants for hot paths where the input is valid by construction.
+// to_chars_unchecked writes to_chars_length(value, base) characters to first, which must have room for them
+// (max_chars_v<T, Base> always suffices), and returns the end of the written characters.
+constexpr char* to_chars_unchecked(char* const _First, const char _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_unchecked(_First, _Value, _Base);
+}
+constexpr char* to_chars_unchecked(char* const _First, const signed char _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_unchecked(_First, _Value, _Base);
+}
+constexpr char* to_chars_unchecked(char* const _First, const unsigned char _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_unchecked(_First, _Value, _Base);
+}
+constexpr char* to_chars_unchecked(char* const _First, const short _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_unchecked(_First, _Value, _Base);
+}
+constexpr char* to_chars_unchecked(char* const _First, const unsigned short _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_unchecked(_First, _Value, _Base);
+}
+constexpr char* to_chars_unchecked(char* const _First, const int _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_unchecked(_First, _Value, _Base);
+}
+constexpr char* to_chars_unchecked(char* const _First, const unsigned int _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_unchecked(_First, _Value, _Base);
+}
+constexpr char* to_chars_unchecked(char* const _First, const long _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_unchecked(_First, _Value, _Base);
+}
+constexpr char* to_chars_unchecked(char* const _First, const unsigned long _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_unchecked(_First, _Value, _Base);
+}
+constexpr char* to_chars_unchecked(char* const _First, const long long _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_unchecked(_First, _Value, _Base);
+}
+constexpr char* to_chars_unchecked(char* const _First, const unsigned long long _Value, const int _Base = 10) noexcept {
+    return _Integer_to_chars_unchecked(_First, _Value, _Base);
+}
+
+char* to_chars_unchecked(char* _First, const bool _Value, const int _Base = 10) = delete;
+
+// from_chars_unchecked parses [first, last), which must be an optional '-' (for signed types) followed only by digits
+// valid in base, and whose value must fit in the destination type.
+constexpr void from_chars_unchecked(const char* const _First, const char* const _Last, char& _Value, const int _Base = 10) noexcept {
+    _Integer_from_chars_unchecked(_First, _Last, _Value, _Base);
+}
+constexpr void from_chars_unchecked(const char* const _First, const char* const _Last, signed char& _Value, const int _Base = 10) noexcept {
+    _Integer_from_chars_unchecked(_First, _Last, _Value, _Base);
+}
+constexpr void from_chars_unchecked(const char* const _First, const char* const _Last, unsigned char& _Value, const int _Base = 10) noexcept {
+    _Integer_from_chars_unchecked(_First, _Last, _Value, _Base);
+}
+constexpr void from_chars_unchecked(const char* const _First, const char* const _Last, short& _Value, const int _Base = 10) noexcept {
+    _Integer_from_chars_unchecked(_First, _Last, _Value, _Base);
+}
+constexpr void from_chars_unchecked(const char* const _First, const char* const _Last, unsigned short& _Value, const int _Base = 10) noexcept {
+    _Integer_from_chars_unchecked(_First, _Last, _Value, _Base);
+}
+constexpr void from_chars_unchecked(const char* const _First, const char* const _Last, int& _Value, const int _Base = 10) noexcept {
+    _Integer_from_chars_unchecked(_First, _Last, _Value, _Base);
+}
+constexpr void from_chars_unchecked(const char* const _First, const char* const _Last, unsigned int& _Value, const int _Base = 10) noexcept {
+    _Integer_from_chars_unchecked(_First, _Last, _Value, _Base);
+}
+constexpr void from_chars_unchecked(const char* const _First, const char* const _Last, long& _Value, const int _Base = 10) noexcept {
+    _Integer_from_chars_unchecked(_First, _Last, _Value, _Base);
+}
+constexpr void from_chars_unchecked(const char* const _First, const char* const _Last, unsigned long& _Value, const int _Base = 10) noexcept {
+    _Integer_from_chars_unchecked(_First, _Last, _Value, _Base);
+}
+constexpr void from_chars_unchecked(const char* const _First, const char* const _Last, long long& _Value, const int _Base = 10) noexcept {
+    _Integer_from_chars_unchecked(_First, _Last, _Value, _Base);
+}
+constexpr void from_chars_unchecked(const char* const _First, const char* const _Last, unsigned long long& _Value, const int _Base = 10) noexcept {
+    _Integer_from_chars_unchecked(_First, _Last, _Value, _Base);
+}
+
+void from_chars_unchecked(const char* _First, const char* _Last, bool& _Value, const int _Base = 10) = delete;
+
 } // namespace nstd
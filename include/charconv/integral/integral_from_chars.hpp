@@ -26,21 +26,238 @@
 // Changes:
 // * add constexpr modifiers to '_Integer_from_chars'
 // * add [[maybe_unused]] to _Uint_max, _Int_max, _Abs_int_min.
+// * add compile-time base overload, dispatch the common bases to it
+// * take _Risky_val and _Max_digit from per-type tables instead of dividing by _Base
+// * decide overflow from the number of significant digits instead of checking every digit
+// * convert short input and constant-evaluated input in one pass, two digits per step, that checks only the digit
+//   where overflow can start
+// * build values with shifts and decide overflow from the significant bit count for power-of-two bases
+// * scan and convert eight decimal digits at a time with SWAR arithmetic at runtime
+// * scan sixteen decimal digits at a time with SSE2 and convert them with SSE4.1 at runtime
+// * scan and convert eight hexadecimal digits at a time with SWAR arithmetic at runtime
+// * scan and convert sixteen binary digits at a time with SSE2 movemask at runtime
+// * add '_Integer_from_chars_unchecked'
+// * add a padding parameter that lets the runtime kernels load past _Last, add '_Integer_from_chars_padded'
+// * add '_Integer_from_chars_fixed'
 
 #pragma once
 
+#include <array>
 #include <cstddef>
+#include <limits>
 #include <type_traits>
 
 #include "charconv/detail/entity.hpp"
 #include "charconv/detail/detail.hpp"
+#include "integral_from_chars_simd.hpp"
+
+#include "third_party/constexpr_utility.hpp"
 
 namespace nstd {
 
-template <class _RawTy>
-_NODISCARD constexpr from_chars_result _Integer_from_chars(const char* const _First, const char* const _Last, _RawTy& _Raw_value, const int _Base) noexcept {
+// Readable bytes past _Last that the padded entry points may load from; the widest kernel load is 16 bytes.
+inline constexpr std::size_t _From_chars_padding = 16;
+
+template <class _Unsigned>
+struct _From_chars_limit {
+    _Unsigned _Risky_val; // largest value that can take one more digit
+    unsigned char _Max_digit; // largest digit that _Risky_val can take
+    unsigned char _Safe_digits; // significant digits that always fit, the digit count of _Risky_val
+};
+
+template <class _Unsigned>
+_NODISCARD constexpr std::array<_From_chars_limit<_Unsigned>, 37> _Make_from_chars_limits(const _Unsigned _Bound) noexcept {
+    std::array<_From_chars_limit<_Unsigned>, 37> _Limits{};
+    for (int _Base = 2; _Base <= 36; ++_Base) {
+        auto& _Limit        = _Limits[static_cast<std::size_t>(_Base)];
+        _Limit._Risky_val   = static_cast<_Unsigned>(_Bound / _Base);
+        _Limit._Max_digit   = static_cast<unsigned char>(_Bound % _Base);
+        _Limit._Safe_digits = static_cast<unsigned char>(_Integer_length<0>(_Limit._Risky_val, _Base));
+    }
+    return _Limits;
+}
+
+// Overflow thresholds of _Integer_from_chars for magnitudes up to _Bound, indexed by base.
+template <class _Unsigned, _Unsigned _Bound>
+inline constexpr std::array<_From_chars_limit<_Unsigned>, 37> _From_chars_limits = _Make_from_chars_limits<_Unsigned>(_Bound);
+
+// The runtime kernels below may load up to _Readable_last, but only ever consume characters up to _Last.
+
+_NODISCARD constexpr const char* _Skip_leading_zeros(
+    const char* _Next, const char* const _Last, [[maybe_unused]] const char* const _Readable_last) noexcept {
+    if (!third_party::is_constant_evaluated()) {
+        while (_Next < _Last && _Readable_last - _Next >= 8 && _Load_8_bytes(_Next) == 0x3030'3030'3030'3030U) {
+            _Next += 8;
+        }
+
+        if (_Next >= _Last) {
+            return _Last;
+        }
+    }
+
+    while (_Next != _Last && *_Next == '0') {
+        ++_Next;
+    }
+
+    return _Next;
+}
+
+template <int _Base>
+_NODISCARD constexpr const char* _Skip_digits(const char* _Next, const char* const _Last,
+    [[maybe_unused]] const char* const _Readable_last, [[maybe_unused]] const int _Base_value) noexcept {
+    // end of the run of digits valid in _Base starting at _Next
+    if constexpr (_Base == 10) {
+        if (!third_party::is_constant_evaluated()) {
+#if NSTD_CHARCONV_SSE2
+            while (_Next < _Last && _Readable_last - _Next >= 16) {
+                const int _Count = _Digit_run_length_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_Next)));
+                _Next += _Count;
+                if (_Count != 16) {
+                    return _Next < _Last ? _Next : _Last;
+                }
+            }
+#endif
+            while (_Next < _Last && _Readable_last - _Next >= 8) {
+                const int _Count = _Digit_run_swar(_Load_8_bytes(_Next));
+                _Next += _Count;
+                if (_Count != 8) {
+                    return _Next < _Last ? _Next : _Last;
+                }
+            }
+        }
+    } else if constexpr (_Base == 2) {
+#if NSTD_CHARCONV_SSE2
+        if (!third_party::is_constant_evaluated()) {
+            while (_Next < _Last && _Readable_last - _Next >= 16) {
+                const int _Count = _Binary_digit_run_sse2(_Next);
+                _Next += _Count;
+                if (_Count != 16) {
+                    return _Next < _Last ? _Next : _Last;
+                }
+            }
+        }
+#endif
+    } else if constexpr (_Base == 16) {
+        if (!third_party::is_constant_evaluated()) {
+            while (_Next < _Last && _Readable_last - _Next >= 8) {
+                unsigned long long _Letters = 0;
+                const int _Count = _Hex_digit_run_swar(_Load_8_bytes(_Next), _Letters);
+                _Next += _Count;
+                if (_Count != 8) {
+                    return _Next < _Last ? _Next : _Last;
+                }
+            }
+        }
+    }
+
+    if (_Next >= _Last) { // a full-width step may end past _Last
+        return _Last;
+    }
+
+    while (_Next != _Last && _Digit_from_char(*_Next) < _Base_value) {
+        ++_Next;
+    }
+
+    return _Next;
+}
+
+template <int _Base, class _Unsigned>
+_NODISCARD constexpr _Unsigned _Accumulate_digits(const char* _Next, const char* const _Digits_last,
+    [[maybe_unused]] const char* const _Readable_last, const int _Base_value) noexcept {
+    // value of the digits in [_Next, _Digits_last), which the caller has validated and knows to fit in _Unsigned
+    _Unsigned _Value = 0;
+
+    if constexpr (_Base == 10 && sizeof(_Unsigned) >= 4) {
+        if (!third_party::is_constant_evaluated()) {
+#if NSTD_CHARCONV_SSE41
+            if constexpr (sizeof(_Unsigned) == 8) {
+                // up to 16 digits at once; the load may look past _Digits_last, but not past _Readable_last
+                if (_Digits_last - _Next > 8 && _Readable_last - _Next >= 16) {
+                    const int _Count = _Digits_last - _Next < 16 ? static_cast<int>(_Digits_last - _Next) : 16;
+                    _Value = static_cast<_Unsigned>(_Parse_16_digits_sse41(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_Next)), _Count));
+                    _Next += _Count;
+                }
+            }
+#endif
+            while (_Digits_last - _Next >= 8) {
+                _Value = static_cast<_Unsigned>(_Value * 100'000'000U + _Parse_8_digits_swar(_Load_8_bytes(_Next)));
+                _Next += 8;
+            }
+
+            // the last 1 to 7 digits from one load, moved to the end of the block behind '0' bytes
+            if (_Digits_last != _Next && _Readable_last - _Next >= 8) {
+                const std::ptrdiff_t _Count = _Digits_last - _Next;
+                const int _Shift            = static_cast<int>(8 - _Count) * 8;
+                const unsigned long long _Block =
+                    _Load_8_bytes(_Next) << _Shift | 0x3030'3030'3030'3030U >> (64 - _Shift);
+                return static_cast<_Unsigned>(_Value * _Pow10[_Count] + _Parse_8_digits_swar(_Block));
+            }
+        }
+    } else if constexpr (_Base == 2) {
+#if NSTD_CHARCONV_SSE2
+        if (!third_party::is_constant_evaluated()) {
+            // 16 digits per step; the last, partial step may look past _Digits_last, but not past _Readable_last
+            while (_Digits_last != _Next && _Readable_last - _Next >= 16) {
+                const int _Count = _Digits_last - _Next < 16 ? static_cast<int>(_Digits_last - _Next) : 16;
+                _Value = static_cast<_Unsigned>(static_cast<unsigned long long>(_Value) << _Count | _Parse_binary_digits_sse2(_Next, _Count));
+                _Next += _Count;
+            }
+        }
+#endif
+    } else if constexpr (_Base == 16 && sizeof(_Unsigned) >= 4) {
+        if (!third_party::is_constant_evaluated()) {
+            while (_Digits_last - _Next >= 8) {
+                const unsigned long long _Block = _Load_8_bytes(_Next);
+                unsigned long long _Letters = 0;
+                static_cast<void>(_Hex_digit_run_swar(_Block, _Letters));
+
+                // a 32-bit type only gets here with _Value == 0
+                _Value = static_cast<_Unsigned>(static_cast<unsigned long long>(_Value) << 32 | _Parse_8_hex_digits_swar(_Block, _Letters));
+                _Next += 8;
+            }
+
+            // the last 1 to 7 digits from one load, moved to the end of the block behind '0' bytes
+            if (_Digits_last != _Next && _Readable_last - _Next >= 8) {
+                const std::ptrdiff_t _Count     = _Digits_last - _Next;
+                const int _Shift                = static_cast<int>(8 - _Count) * 8;
+                const unsigned long long _Block = _Load_8_bytes(_Next) << _Shift | 0x3030'3030'3030'3030U >> (64 - _Shift);
+                unsigned long long _Letters = 0;
+                static_cast<void>(_Hex_digit_run_swar(_Block, _Letters));
+
+                return static_cast<_Unsigned>(static_cast<unsigned long long>(_Value) << (_Count * 4) | _Parse_8_hex_digits_swar(_Block, _Letters));
+            }
+        }
+    }
+
+    if constexpr (_Base != 0 && (_Base & (_Base - 1)) == 0) {
+        constexpr int _Bits_per_digit = _Bit_width(static_cast<unsigned int>(_Base)) - 1;
+
+        for (; _Next != _Digits_last; ++_Next) {
+            _Value = static_cast<_Unsigned>(_Value << _Bits_per_digit | _Digit_from_char(*_Next));
+        }
+    } else {
+        for (; _Next != _Digits_last; ++_Next) {
+            _Value = static_cast<_Unsigned>(_Value * _Base_value + _Digit_from_char(*_Next));
+        }
+    }
+
+    return _Value;
+}
+
+// _Base is the base when it is known at compile time,
+// or 0 when it is only known at run time and passed in _Dynamic_base.
+// _Padding is the number of readable bytes past _Last that the runtime kernels may load from.
+template <int _Base, std::size_t _Padding = 0, class _RawTy>
+_NODISCARD constexpr from_chars_result _Integer_from_chars(const char* const _First, const char* const _Last, _RawTy& _Raw_value,
+    [[maybe_unused]] const int _Dynamic_base = _Base) noexcept {
+    static_assert(_Base == 0 || (_Base >= 2 && _Base <= 36), "invalid base in from_chars()");
     nstd_verify_range(_First, _Last);
-    nstd_assert_msg(_Base >= 2 && _Base <= 36, "invalid base in from_chars()");
+
+    // forming a pointer past the end of the object isn't allowed in constant evaluation, where the kernels don't run
+    const char* const _Readable_last =
+        _Padding != 0 && !third_party::is_constant_evaluated() ? _Last + _Padding : _Last;
+
+    const int _Base_value = _Base != 0 ? _Base : _Dynamic_base;
 
     bool _Minus_sign = false;
 
@@ -60,47 +277,136 @@ _NODISCARD constexpr from_chars_result _Integer_from_chars(const char* const _Fi
     [[maybe_unused]] constexpr _Unsigned _Int_max     = static_cast<_Unsigned>(_Uint_max >> 1);
     [[maybe_unused]] constexpr _Unsigned _Abs_int_min = static_cast<_Unsigned>(_Int_max + 1);
 
-    _Unsigned _Risky_val;
-    _Unsigned _Max_digit;
+    const _From_chars_limit<_Unsigned>* _Limits = _From_chars_limits<_Unsigned, _Uint_max>.data();
 
     if constexpr (std::is_signed_v<_RawTy>) {
-        if (_Minus_sign) {
-            _Risky_val = static_cast<_Unsigned>(_Abs_int_min / _Base);
-            _Max_digit = static_cast<_Unsigned>(_Abs_int_min % _Base);
-        } else {
-            _Risky_val = static_cast<_Unsigned>(_Int_max / _Base);
-            _Max_digit = static_cast<_Unsigned>(_Int_max % _Base);
-        }
-    } else {
-        _Risky_val = static_cast<_Unsigned>(_Uint_max / _Base);
-        _Max_digit = static_cast<_Unsigned>(_Uint_max % _Base);
+        _Limits = _Minus_sign ? _From_chars_limits<_Unsigned, _Abs_int_min>.data() : _From_chars_limits<_Unsigned, _Int_max>.data();
     }
 
+    const _From_chars_limit<_Unsigned>& _Limit = _Limits[_Base_value];
+
+    // bytes that one step of the widest kernel for _Base loads, or 0 when there is no such kernel
+    constexpr std::ptrdiff_t _Kernel_width = (_Base == 10 || _Base == 16) && sizeof(_Unsigned) >= 4 ? 8
+                                           : _Base == 2 && NSTD_CHARCONV_SSE2                       ? 16
+                                                                                                    : 0;
+
+    const char* const _Digits_first = _Next;
+
     _Unsigned _Value = 0;
 
-    bool _Overflowed = false;
+    // Scanning the digits before converting them only pays off when a kernel takes a wide step over them; short input
+    // and constant evaluation take a single pass that converts every digit once instead.
+    if (_Kernel_width == 0 || _Readable_last - _Next < _Kernel_width || third_party::is_constant_evaluated()) {
+        while (_Next != _Last && *_Next == '0') {
+            ++_Next;
+        }
+
+        // Any number with at most _Safe_digits significant digits fits, so only the digit after them needs the risky
+        // value check; anything longer overflows.
+        const char* const _Safe_last = _Last - _Next > _Limit._Safe_digits ? _Next + _Limit._Safe_digits : _Last;
 
-    for (; _Next != _Last; ++_Next) {
-        const unsigned char _Digit = _Digit_from_char(*_Next);
+        // two digits per step, which halves the loop overhead in constant evaluation
+        for (; _Safe_last - _Next >= 2; _Next += 2) {
+            const unsigned char _High = _Digit_from_char(_Next[0]);
+            const unsigned char _Low  = _Digit_from_char(_Next[1]);
 
-        if (_Digit >= _Base) {
-            break;
+            if (_High >= _Base_value || _Low >= _Base_value) {
+                break;
+            }
+
+            _Value = static_cast<_Unsigned>((_Value * _Base_value + _High) * _Base_value + _Low);
         }
 
-        if (_Value < _Risky_val // never overflows
-            || (_Value == _Risky_val && _Digit <= _Max_digit)) { // overflows for certain digits
-            _Value = static_cast<_Unsigned>(_Value * _Base + _Digit);
-        } else { // _Value > _Risky_val always overflows
-            _Overflowed = true; // keep going, _Next still needs to be updated, _Value is now irrelevant
+        for (; _Next != _Safe_last; ++_Next) {
+            const unsigned char _Digit = _Digit_from_char(*_Next);
+
+            if (_Digit >= _Base_value) {
+                break;
+            }
+
+            _Value = static_cast<_Unsigned>(_Value * _Base_value + _Digit);
         }
-    }
 
-    if (_Next - _First == static_cast<std::ptrdiff_t>(_Minus_sign)) {
-        return {_First, errc::invalid_argument};
-    }
+        if (_Next == _Digits_first) {
+            return {_First, errc::invalid_argument};
+        }
+
+        if (_Next == _Safe_last && _Next != _Last) {
+            const unsigned char _Digit = _Digit_from_char(*_Next);
 
-    if (_Overflowed) {
-        return {_Next, errc::result_out_of_range};
+            if (_Digit < _Base_value) {
+                bool _Overflowed = true;
+
+                if (_Value < _Limit._Risky_val // never overflows
+                    || (_Value == _Limit._Risky_val && _Digit <= _Limit._Max_digit)) { // overflows for certain digits
+                    _Value      = static_cast<_Unsigned>(_Value * _Base_value + _Digit);
+                    _Overflowed = false;
+                }
+
+                while (++_Next != _Last && _Digit_from_char(*_Next) < _Base_value) {
+                    _Overflowed = true;
+                }
+
+                if (_Overflowed) {
+                    return {_Next, errc::result_out_of_range};
+                }
+            }
+        }
+    } else {
+        const char* const _Significant_first = _Skip_leading_zeros(_Next, _Last, _Readable_last);
+
+        _Next = _Skip_digits<_Base>(_Significant_first, _Last, _Readable_last, _Base_value);
+
+        if (_Next == _Digits_first) {
+            return {_First, errc::invalid_argument};
+        }
+
+        const std::ptrdiff_t _Significant_digits = _Next - _Significant_first;
+
+        if constexpr (_Base != 0 && (_Base & (_Base - 1)) == 0) {
+            // Every digit is exactly _Bits_per_digit bits, so the significant bit count decides overflow.
+            constexpr int _Bits_per_digit = _Bit_width(static_cast<unsigned int>(_Base)) - 1;
+
+            _Unsigned _Bound = _Uint_max;
+
+            if constexpr (std::is_signed_v<_RawTy>) {
+                _Bound = _Minus_sign ? _Abs_int_min : _Int_max;
+            }
+
+            if (_Significant_digits != 0) {
+                const int _Leading_bits = _Bit_width(static_cast<unsigned int>(_Digit_from_char(*_Significant_first)));
+                if ((_Significant_digits - 1) * _Bits_per_digit + _Leading_bits > _Bit_width(_Bound)) {
+                    return {_Next, errc::result_out_of_range};
+                }
+            }
+
+            _Value = _Accumulate_digits<_Base, _Unsigned>(_Significant_first, _Next, _Readable_last, _Base_value);
+
+            if (_Value > _Bound) { // only |min| of a signed type has as many bits as its bound without being all ones
+                return {_Next, errc::result_out_of_range};
+            }
+        } else {
+            // Any number with fewer significant digits than the limit fits, so only a number with exactly as many
+            // digits as the limit needs the risky value check, and only on its last digit; anything longer overflows.
+            if (_Significant_digits > _Limit._Safe_digits + 1) {
+                return {_Next, errc::result_out_of_range};
+            }
+
+            const char* const _Unchecked_last = _Significant_digits > _Limit._Safe_digits ? _Next - 1 : _Next;
+
+            _Value = _Accumulate_digits<_Base, _Unsigned>(_Significant_first, _Unchecked_last, _Readable_last, _Base_value);
+
+            if (_Unchecked_last != _Next) {
+                const unsigned char _Digit = _Digit_from_char(*_Unchecked_last);
+
+                if (_Value < _Limit._Risky_val // never overflows
+                    || (_Value == _Limit._Risky_val && _Digit <= _Limit._Max_digit)) { // overflows for certain digits
+                    _Value = static_cast<_Unsigned>(_Value * _Base_value + _Digit);
+                } else { // _Value > _Risky_val always overflows
+                    return {_Next, errc::result_out_of_range};
+                }
+            }
+        }
     }
 
     if constexpr (std::is_signed_v<_RawTy>) {
@@ -114,4 +420,131 @@ _NODISCARD constexpr from_chars_result _Integer_from_chars(const char* const _Fi
     return {_Next, errc{}};
 }
 
+template <class _RawTy>
+_NODISCARD constexpr from_chars_result _Integer_from_chars(const char* const _First, const char* const _Last, _RawTy& _Raw_value, const int _Base) noexcept {
+    nstd_assert_msg(_Base >= 2 && _Base <= 36, "invalid base in from_chars()");
+
+    switch (_Base) {
+    case 10:
+        return _Integer_from_chars<10>(_First, _Last, _Raw_value);
+    case 2:
+        return _Integer_from_chars<2>(_First, _Last, _Raw_value);
+    case 4:
+        return _Integer_from_chars<4>(_First, _Last, _Raw_value);
+    case 8:
+        return _Integer_from_chars<8>(_First, _Last, _Raw_value);
+    case 16:
+        return _Integer_from_chars<16>(_First, _Last, _Raw_value);
+    case 32:
+        return _Integer_from_chars<32>(_First, _Last, _Raw_value);
+    default:
+        return _Integer_from_chars<0>(_First, _Last, _Raw_value, _Base);
+    }
+}
+
+// Parses exactly _Digits decimal digits at _First, e.g. a zero-padded fixed-width field. There is no sign, and
+// anything other than _Digits digits is invalid.
+template <std::size_t _Digits, class _RawTy>
+_NODISCARD constexpr from_chars_result _Integer_from_chars_fixed(const char* const _First, const char* const _Last, _RawTy& _Raw_value) noexcept {
+    static_assert(_Digits >= 1 && _Digits <= 19, "from_chars_fixed() parses 1 to 19 digits"); // 19 digits always fit
+    nstd_verify_range(_First, _Last);
+
+    if (static_cast<std::size_t>(_Last - _First) < _Digits) {
+        return {_First, errc::invalid_argument};
+    }
+
+    unsigned long long _Value = 0;
+    bool _Valid               = true;
+
+    if (!third_party::is_constant_evaluated()) {
+        _Valid = _Parse_fixed_digits<_Digits>(_First, _Value);
+    } else {
+        for (std::size_t _Idx = 0; _Idx != _Digits; ++_Idx) {
+            const unsigned char _Digit = static_cast<unsigned char>(_First[_Idx] - '0');
+            _Valid &= _Digit <= 9;
+            _Value = _Value * 10 + _Digit;
+        }
+    }
+
+    if (!_Valid) {
+        return {_First, errc::invalid_argument};
+    }
+
+    if (_Value > static_cast<unsigned long long>((std::numeric_limits<_RawTy>::max)())) {
+        return {_First + _Digits, errc::result_out_of_range};
+    }
+
+    _Raw_value = static_cast<_RawTy>(_Value);
+
+    return {_First + _Digits, errc{}};
+}
+
+template <class _RawTy>
+_NODISCARD constexpr from_chars_result _Integer_from_chars_padded(const char* const _First, const char* const _Last, _RawTy& _Raw_value, const int _Base) noexcept {
+    nstd_assert_msg(_Base >= 2 && _Base <= 36, "invalid base in from_chars_padded()");
+
+    switch (_Base) {
+    case 10:
+        return _Integer_from_chars<10, _From_chars_padding>(_First, _Last, _Raw_value);
+    case 2:
+        return _Integer_from_chars<2, _From_chars_padding>(_First, _Last, _Raw_value);
+    case 4:
+        return _Integer_from_chars<4, _From_chars_padding>(_First, _Last, _Raw_value);
+    case 8:
+        return _Integer_from_chars<8, _From_chars_padding>(_First, _Last, _Raw_value);
+    case 16:
+        return _Integer_from_chars<16, _From_chars_padding>(_First, _Last, _Raw_value);
+    case 32:
+        return _Integer_from_chars<32, _From_chars_padding>(_First, _Last, _Raw_value);
+    default:
+        return _Integer_from_chars<0, _From_chars_padding>(_First, _Last, _Raw_value, _Base);
+    }
+}
+
+// [_First, _Last) must be an optional '-' (for signed types) followed only by digits valid in the base, whose value
+// fits in _RawTy. Nothing is checked.
+template <int _Base, class _RawTy>
+constexpr void _Integer_from_chars_unchecked(
+    const char* _First, const char* const _Last, _RawTy& _Raw_value, const int _Dynamic_base = _Base) noexcept {
+    using _Unsigned = std::make_unsigned_t<_RawTy>;
+
+    bool _Minus_sign = false;
+
+    if constexpr (std::is_signed_v<_RawTy>) {
+        if (_First != _Last && *_First == '-') {
+            _Minus_sign = true;
+            ++_First;
+        }
+    }
+
+    // the digit kernels expect no leading zeros
+    _Unsigned _Value = _Accumulate_digits<_Base, _Unsigned>(_Skip_leading_zeros(_First, _Last, _Last), _Last, _Last, _Dynamic_base);
+
+    if (_Minus_sign) {
+        _Value = static_cast<_Unsigned>(0 - _Value);
+    }
+
+    _Raw_value = static_cast<_RawTy>(_Value);
+}
+
+template <class _RawTy>
+constexpr void _Integer_from_chars_unchecked(const char* const _First, const char* const _Last, _RawTy& _Raw_value, const int _Base) noexcept {
+    switch (_Base) {
+    case 10:
+        return _Integer_from_chars_unchecked<10>(_First, _Last, _Raw_value);
+    case 2:
+        return _Integer_from_chars_unchecked<2>(_First, _Last, _Raw_value);
+    case 4:
+        return _Integer_from_chars_unchecked<4>(_First, _Last, _Raw_value);
+    case 8:
+        return _Integer_from_chars_unchecked<8>(_First, _Last, _Raw_value);
+    case 16:
+        return _Integer_from_chars_unchecked<16>(_First, _Last, _Raw_value);
+    case 32:
+        return _Integer_from_chars_unchecked<32>(_First, _Last, _Raw_value);
+    default:
+        return _Integer_from_chars_unchecked<0>(_First, _Last, _Raw_value, _Base);
+    }
+}
+
 } // namespace nstd
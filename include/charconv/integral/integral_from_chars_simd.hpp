@@ -0,0 +1,213 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019-2020 Daniil Goncharov <neargye@gmail.com>, Karaev Alexander <akaraevz@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Runtime-only kernels for _Integer_from_chars. They are not constexpr; callers must only reach them when
+// !third_party::is_constant_evaluated().
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+#include "charconv/detail/detail.hpp"
+#include "charconv/detail/simd.hpp"
+
+namespace nstd {
+
+// Loads eight bytes so that _Ptr[0] ends up in the least significant byte.
+inline unsigned long long _Load_8_bytes(const char* const _Ptr) noexcept {
+    unsigned long long _Val;
+    std::memcpy(&_Val, _Ptr, sizeof(_Val));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    _Val = __builtin_bswap64(_Val);
+#endif
+    return _Val;
+}
+
+// Loads _Count (1 to 8) bytes like _Load_8_bytes, with '0' bytes in front of them in place of the missing ones.
+template <std::size_t _Count>
+inline unsigned long long _Load_zero_filled(const char* const _Ptr) noexcept {
+    static_assert(_Count >= 1 && _Count <= 8);
+    char _Buff[8] = {'0', '0', '0', '0', '0', '0', '0', '0'};
+    std::memcpy(_Buff + (8 - _Count), _Ptr, _Count);
+    return _Load_8_bytes(_Buff);
+}
+
+// True when all eight bytes of _Val are '0' to '9'.
+inline bool _Is_8_digits_swar(const unsigned long long _Val) noexcept {
+    // a byte is a digit when its high nibble is 3 and adding 6 doesn't carry out of the low nibble
+    return ((_Val & 0xF0F0'F0F0'F0F0'F0F0U) | (((_Val + 0x0606'0606'0606'0606U) & 0xF0F0'F0F0'F0F0'F0F0U) >> 4))
+        == 0x3333'3333'3333'3333U;
+}
+
+// Converts eight ASCII digits (as loaded by _Load_8_bytes) to their value.
+inline unsigned int _Parse_8_digits_swar(unsigned long long _Val) noexcept {
+    constexpr unsigned long long _Mask = 0x0000'00FF'0000'00FFU;
+    constexpr unsigned long long _Mul1 = 100 + (1'000'000ULL << 32);
+    constexpr unsigned long long _Mul2 = 1 + (10'000ULL << 32);
+
+    _Val -= 0x3030'3030'3030'3030U;
+    _Val = _Val * 10 + (_Val >> 8); // pairs of digits
+    _Val = ((_Val & _Mask) * _Mul1 + ((_Val >> 16) & _Mask) * _Mul2) >> 32; // all eight
+    return static_cast<unsigned int>(_Val);
+}
+
+// For every byte of _Val in [_Lo, _Hi] (both at most 0x7F), sets the top bit of that byte; clears all other bits.
+inline unsigned long long _Bytes_in_range_swar(const unsigned long long _Val, const unsigned char _Lo, const unsigned char _Hi) noexcept {
+    constexpr unsigned long long _Ones = 0x0101'0101'0101'0101U;
+    const unsigned long long _Low7     = _Val & (_Ones * 0x7F);
+    const unsigned long long _At_least = _Low7 + _Ones * (0x80U - _Lo); // top bit set if byte >= _Lo
+    const unsigned long long _Above    = _Low7 + _Ones * (0x7FU - _Hi); // top bit set if byte > _Hi
+    return _At_least & ~_Above & ~_Val & (_Ones * 0x80);
+}
+
+// Number of leading bytes of _Val (as loaded by _Load_8_bytes) that are '0' to '9', 0 to 8.
+inline int _Digit_run_swar(const unsigned long long _Val) noexcept {
+    return _Countr_zero(~_Bytes_in_range_swar(_Val, '0', '9') & 0x8080'8080'8080'8080U) / 8;
+}
+
+// Number of leading bytes of _Val (as loaded by _Load_8_bytes) that are hexadecimal digits, 0 to 8;
+// _Letters gets the top bit of each byte that is 'a' to 'f' or 'A' to 'F'.
+inline int _Hex_digit_run_swar(const unsigned long long _Val, unsigned long long& _Letters) noexcept {
+    const unsigned long long _Digits = _Bytes_in_range_swar(_Val, '0', '9');
+    _Letters                         = _Bytes_in_range_swar(_Val | 0x2020'2020'2020'2020U, 'a', 'f');
+    return _Countr_zero(~(_Digits | _Letters) & 0x8080'8080'8080'8080U) / 8;
+}
+
+// Converts eight hexadecimal digits (as loaded by _Load_8_bytes, with _Letters from _Hex_digit_run_swar) to their value.
+inline unsigned int _Parse_8_hex_digits_swar(const unsigned long long _Val, const unsigned long long _Letters) noexcept {
+    // '0' to '9' keep their low nibble, letters have low nibbles 1 to 6 and need 9 more
+    unsigned long long _Nibbles = (_Val & 0x0F0F'0F0F'0F0F'0F0FU) + (_Letters >> 7) * 9;
+
+    _Nibbles = (_Nibbles * 0x10 + (_Nibbles >> 8)) & 0x00FF'00FF'00FF'00FFU; // pairs of digits
+    _Nibbles = (_Nibbles * 0x100 + (_Nibbles >> 16)) & 0x0000'FFFF'0000'FFFFU; // quads
+    return static_cast<unsigned int>(_Nibbles * 0x1'0000 + (_Nibbles >> 32)); // all eight
+}
+
+#if NSTD_CHARCONV_SSE2
+
+// Reverses the order of the 16 bytes of _Val.
+inline __m128i _Reverse_bytes_sse2(__m128i _Val) noexcept {
+#if NSTD_CHARCONV_SSSE3
+    return _mm_shuffle_epi8(_Val, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+#else
+    _Val = _mm_shufflelo_epi16(_Val, 0x1B);
+    _Val = _mm_shufflehi_epi16(_Val, 0x1B);
+    _Val = _mm_shuffle_epi32(_Val, 0x4E);
+    return _mm_or_si128(_mm_slli_epi16(_Val, 8), _mm_srli_epi16(_Val, 8));
+#endif
+}
+
+// Number of leading '0' or '1' bytes in the 16 bytes at _Ptr, 0 to 16.
+inline int _Binary_digit_run_sse2(const char* const _Ptr) noexcept {
+    // byte i of the input lands in bit 15 - i of the mask
+    const __m128i _Chunk   = _Reverse_bytes_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_Ptr)));
+    const __m128i _Binary  = _mm_cmpeq_epi8(_mm_and_si128(_Chunk, _mm_set1_epi8(static_cast<char>(0xFE))), _mm_set1_epi8('0'));
+    const auto _Not_binary = static_cast<unsigned short>(~_mm_movemask_epi8(_Binary));
+    return _Countl_zero(_Not_binary);
+}
+
+// Value of the _Count (1 to 16) binary digits at _Ptr; 16 bytes must be readable.
+inline unsigned int _Parse_binary_digits_sse2(const char* const _Ptr, const int _Count) noexcept {
+    // byte i of the input lands in bit 15 - i, so the first digit is the most significant bit
+    const __m128i _Chunk    = _Reverse_bytes_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_Ptr)));
+    const unsigned int _Ones = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_Chunk, _mm_set1_epi8('1'))));
+    return _Ones >> (16 - _Count);
+}
+
+// Number of leading '0' to '9' bytes in _Chunk, 0 to 16.
+inline int _Digit_run_length_sse2(const __m128i _Chunk) noexcept {
+    // c - '0' < 10 as an unsigned compare, done as a signed one by flipping the top bit
+    const __m128i _Biased   = _mm_sub_epi8(_Chunk, _mm_set1_epi8(static_cast<char>('0' + 0x80)));
+    const __m128i _Is_digit = _mm_cmplt_epi8(_Biased, _mm_set1_epi8(static_cast<char>(0x80 + 10)));
+    const unsigned int _Not_digit = ~static_cast<unsigned int>(_mm_movemask_epi8(_Is_digit));
+    return _Countr_zero(_Not_digit | 0x1'0000U);
+}
+
+#endif // NSTD_CHARCONV_SSE2
+
+#if NSTD_CHARCONV_SSE41
+
+// Converts the _Count (1 to 16) leading digits of _Chunk to their value.
+inline unsigned long long _Parse_16_digits_sse41(const __m128i _Chunk, const int _Count) noexcept {
+    // Right-align the digits and zero the lanes in front of them: lane i takes byte i - (16 - _Count).
+    constexpr signed char _Shuffles[32] = {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 2, 3,
+        4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+    const __m128i _Shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Shuffles + _Count));
+    const __m128i _Digits  = _mm_shuffle_epi8(_mm_sub_epi8(_Chunk, _mm_set1_epi8('0')), _Shuffle);
+
+    // 16 digits -> 8 pairs -> 4 quads -> 2 octets
+    const __m128i _Pairs = _mm_maddubs_epi16(_Digits, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+    const __m128i _Quads = _mm_madd_epi16(_Pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+    const __m128i _Octets =
+        _mm_madd_epi16(_mm_packus_epi32(_Quads, _Quads), _mm_setr_epi16(10'000, 1, 10'000, 1, 10'000, 1, 10'000, 1));
+
+    const unsigned int _High = static_cast<unsigned int>(_mm_cvtsi128_si32(_Octets));
+    const unsigned int _Low  = static_cast<unsigned int>(_mm_cvtsi128_si32(_mm_srli_si128(_Octets, 4)));
+    return _High * 100'000'000ULL + _Low;
+}
+
+#endif // NSTD_CHARCONV_SSE41
+
+// The SWAR path of _Parse_fixed_digits, for every _Digits without a wider kernel.
+template <std::size_t _Digits>
+inline bool _Parse_fixed_digits_swar(const char* const _Ptr, unsigned long long& _Value) noexcept {
+    constexpr std::size_t _Head = _Digits % 8;
+
+    bool _Valid                = true;
+    unsigned long long _Result = 0;
+
+    if constexpr (_Head != 0) {
+        const unsigned long long _Block = _Load_zero_filled<_Head>(_Ptr);
+        _Valid                          = _Is_8_digits_swar(_Block);
+        _Result                         = _Parse_8_digits_swar(_Block);
+    }
+
+    for (std::size_t _Idx = _Head; _Idx != _Digits; _Idx += 8) {
+        const unsigned long long _Block = _Load_8_bytes(_Ptr + _Idx);
+        _Valid &= _Is_8_digits_swar(_Block);
+        _Result = _Result * 100'000'000U + _Parse_8_digits_swar(_Block);
+    }
+
+    _Value = _Result;
+    return _Valid;
+}
+
+// Converts exactly _Digits (1 to 19) characters at _Ptr to _Value and returns whether all of them are digits.
+// Every character is loaded and checked without branching on the input: sixteen digits take one SSE4.1 load, anything
+// else takes blocks of eight with SWAR arithmetic, where a short leading block (e.g. for 2 or 4 digits) is zero-filled.
+template <std::size_t _Digits>
+inline bool _Parse_fixed_digits(const char* const _Ptr, unsigned long long& _Value) noexcept {
+#if NSTD_CHARCONV_SSE41
+    if constexpr (_Digits == 16) {
+        const __m128i _Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Ptr));
+        _Value               = _Parse_16_digits_sse41(_Chunk, 16);
+        return _Digit_run_length_sse2(_Chunk) == 16;
+    } else {
+        return _Parse_fixed_digits_swar<_Digits>(_Ptr, _Value);
+    }
+#else
+    return _Parse_fixed_digits_swar<_Digits>(_Ptr, _Value);
+#endif
+}
+
+} // namespace nstd
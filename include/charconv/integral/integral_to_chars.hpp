@@ -25,63 +25,111 @@
 
 // Changes:
 // * add constexpr modifiers to '_Integer_to_chars'
-// * change '_CSTD memcpy' to 'third_party::trivial_copy'
+// * compute the exact length up front and write digits directly, instead of '_CSTD memcpy' from a buffer
+// * emit two decimal digits per division using '_Digit_pairs'
+// * use Ryu's '_Div1e9' for 64-bit chunks on 32-bit platforms
+// * use an SSE2 kernel for long 64-bit decimal values at runtime on 64-bit targets
+// * use an SSE2/SSSE3 kernel for hexadecimal values at runtime
+// * write binary and octal digits eight at a time with a bit spread (BMI2 pdep) at runtime
+// * use multiply-shift reciprocals and 32-bit chunks for the other bases
+// * add compile-time base overload, dispatch the common bases to it
+// * add '_Integer_to_chars_length' and '_Integer_to_chars_max_length'
+// * split the digit writer out as '_Write_integer_digits', add '_Integer_to_chars_unchecked'
+// * use one division per digit for the other bases in constant evaluation
 
 #pragma once
 
+#include <array>
 #include <cstddef>
-#include <climits>
+#include <limits>
 #include <type_traits>
 
 #include "charconv/detail/entity.hpp"
 #include "charconv/detail/detail.hpp"
+#include "integral_to_chars_simd.hpp"
 
 #include "third_party/constexpr_utility.hpp"
 
 namespace nstd {
 
-template <class _RawTy>
-_NODISCARD constexpr to_chars_result _Integer_to_chars(char* _First, char* const _Last, const _RawTy _Raw_value, const int _Base) noexcept {
-    nstd_verify_range(_First, _Last);
-    nstd_assert_msg(_Base >= 2 && _Base <= 36, "invalid base in to_chars()");
+struct _Base_divisor {
+    unsigned int _Chunk; // largest power of the base that fits in 32 bits
+    int _Chunk_digits; // number of digits in a chunk, i.e. log(_Chunk) in the base
+    unsigned long long _Multiplier; // ceil(2^_Shift / base), less than 2^32
+    int _Shift;
+};
 
-    using _Unsigned = std::make_unsigned_t<_RawTy>;
+_NODISCARD constexpr std::array<_Base_divisor, 37> _Make_base_divisors() noexcept {
+    std::array<_Base_divisor, 37> _Divisors{};
+    for (unsigned int _Base = 2; _Base <= 36; ++_Base) {
+        auto& _Div = _Divisors[_Base];
 
-    _Unsigned _Value = static_cast<_Unsigned>(_Raw_value);
+        unsigned long long _Chunk = 1;
+        while (_Chunk * _Base <= 0xFFFF'FFFFU) {
+            _Chunk *= _Base;
+            ++_Div._Chunk_digits;
+        }
+        _Div._Chunk = static_cast<unsigned int>(_Chunk);
 
-    if constexpr (std::is_signed_v<_RawTy>) {
-        if (_Raw_value < 0) {
-            if (_First == _Last) {
-                return {_Last, errc::value_too_large};
+        // The smallest shift whose rounding error can't reach the next integer for any _Val < _Chunk:
+        // (_Chunk - 1) * (_Multiplier * _Base - 2^_Shift) < 2^_Shift. It exists for every base.
+        for (_Div._Shift = 32;; ++_Div._Shift) {
+            const unsigned long long _Pow = 1ULL << _Div._Shift;
+            _Div._Multiplier              = (_Pow + _Base - 1) / _Base;
+            if (_Div._Multiplier <= 0xFFFF'FFFFU && (_Chunk - 1) * (_Div._Multiplier * _Base - _Pow) < _Pow) {
+                break;
             }
-
-            *_First++ = '-';
-
-            _Value = static_cast<_Unsigned>(0 - _Value);
         }
     }
+    return _Divisors;
+}
 
-    constexpr std::size_t _Buff_size = sizeof(_Unsigned) * CHAR_BIT; // enough for base 2
-    char _Buff[_Buff_size];
-    char* const _Buff_end = _Buff + _Buff_size;
-    char* _RNext          = _Buff_end;
+// Multiply-shift reciprocals of every base for _Integer_to_chars, indexed by base.
+inline constexpr std::array<_Base_divisor, 37> _Base_divisors = _Make_base_divisors();
+
+_NODISCARD constexpr unsigned int _Div_by_base(const unsigned int _Val, const _Base_divisor& _Div) noexcept {
+    // _Val / base for _Val < _Div._Chunk, as a single 32x32->64 multiplication
+    return static_cast<unsigned int>(_Val * _Div._Multiplier >> _Div._Shift);
+}
+
+// Writes the _Digits_written digits of _Value to [_First, _First + _Digits_written) and returns the end.
+// _Digits_written must be _Integer_length<_Base>(_Value, _Dynamic_base): the digits are written backwards straight into
+// the destination.
+template <int _Base, class _Unsigned>
+_NODISCARD constexpr char* _Write_integer_digits(
+    char* const _First, _Unsigned _Value, const int _Digits_written, [[maybe_unused]] const int _Dynamic_base) noexcept {
+    char* const _End = _First + _Digits_written;
+    char* _RNext     = _End;
+
+    if constexpr (_Base == 10) { // Derived from _UIntegral_to_buff()
+#if NSTD_CHARCONV_SSE2
+        // the kernel divides in 64 bits, which 32-bit targets do with a helper call, so they keep the chunked path
+        if constexpr (sizeof(_Unsigned) == 8 && sizeof(std::size_t) == 8) {
+            // below 13 digits the scalar digit-pair loop is just as fast
+            if (_Digits_written > 12 && !third_party::is_constant_evaluated()) {
+                _Write_decimal_sse2(_First, _Value, _Digits_written);
+                return _End;
+            }
+        }
+#endif
 
-    switch (_Base) {
-    case 10: { // Derived from _UIntegral_to_buff()
-        // Performance note: Ryu's digit table should be faster here.
         constexpr bool _Use_chunks = sizeof(_Unsigned) > sizeof(size_t);
 
         if constexpr (_Use_chunks) { // For 64-bit numbers on 32-bit platforms, work in chunks to avoid 64-bit
                                      // divisions.
             while (_Value > 0xFFFF'FFFFU) {
-                // Performance note: Ryu's division workaround would be faster here.
-                unsigned long _Chunk = static_cast<unsigned long>(_Value % 1'000'000'000);
-                _Value               = static_cast<_Unsigned>(_Value / 1'000'000'000);
+                // Ryu's division workaround: multiply by the reciprocal, then recover the remainder in 32 bits.
+                const _Unsigned _Quotient = static_cast<_Unsigned>(_Div1e9(_Value));
+                unsigned long _Chunk      = static_cast<unsigned long>(_Value) - 1'000'000'000UL * static_cast<unsigned long>(_Quotient);
+                _Value                    = _Quotient;
 
-                for (int _Idx = 0; _Idx != 9; ++_Idx) {
-                    *--_RNext = static_cast<char>('0' + _Chunk % 10);
-                    _Chunk /= 10;
+                for (int _Idx = 0; _Idx != 4; ++_Idx) {
+                    const unsigned long _Pair = _Chunk % 100 * 2;
+                    _Chunk /= 100;
+                    *--_RNext = _Digit_pairs[_Pair + 1];
+                    *--_RNext = _Digit_pairs[_Pair];
                 }
+                *--_RNext = static_cast<char>('0' + _Chunk);
             }
         }
 
@@ -89,66 +137,232 @@ _NODISCARD constexpr to_chars_result _Integer_to_chars(char* _First, char* const
 
         _Truncated _Trunc = static_cast<_Truncated>(_Value);
 
-        do {
-            *--_RNext = static_cast<char>('0' + _Trunc % 10);
-            _Trunc /= 10;
-        } while (_Trunc != 0);
-        break;
-    }
+        while (_Trunc >= 100) {
+            const _Truncated _Pair = static_cast<_Truncated>(_Trunc % 100 * 2);
+            _Trunc /= 100;
+            *--_RNext = _Digit_pairs[_Pair + 1];
+            *--_RNext = _Digit_pairs[_Pair];
+        }
 
-    case 2:
-        do {
-            *--_RNext = static_cast<char>('0' + (_Value & 0b1));
-            _Value >>= 1;
-        } while (_Value != 0);
-        break;
+        if (_Trunc >= 10) {
+            *--_RNext = _Digit_pairs[_Trunc * 2 + 1];
+            *--_RNext = _Digit_pairs[_Trunc * 2];
+        } else {
+            *--_RNext = static_cast<char>('0' + _Trunc);
+        }
+    } else if constexpr (_Base != 0 && (_Base & (_Base - 1)) == 0) {
+        constexpr int _Bits_per_digit = _Bit_width(static_cast<unsigned int>(_Base)) - 1;
+        constexpr _Unsigned _Mask     = _Base - 1;
 
-    case 4:
-        do {
-            *--_RNext = static_cast<char>('0' + (_Value & 0b11));
-            _Value >>= 2;
-        } while (_Value != 0);
-        break;
+#if NSTD_CHARCONV_LITTLE_ENDIAN
+        if constexpr (_Base == 2 || _Base == 8) {
+            if (_Digits_written >= 8 && !third_party::is_constant_evaluated()) {
+                _Write_spread_digits<_Bits_per_digit>(_First, _Value, _Digits_written);
+                return _End;
+            }
+        }
+#endif
 
-    case 8:
-        do {
-            *--_RNext = static_cast<char>('0' + (_Value & 0b111));
-            _Value >>= 3;
-        } while (_Value != 0);
-        break;
+#if NSTD_CHARCONV_SSE2
+        if constexpr (_Base == 16 && sizeof(_Unsigned) >= 4) {
+            if (_Digits_written > 4 && !third_party::is_constant_evaluated()) {
+                _Write_hex_sse2(_First, _Value, _Digits_written);
+                return _End;
+            }
+        }
+#endif
 
-    case 16:
         do {
-            *--_RNext = _Charconv_digits[_Value & 0b1111];
-            _Value >>= 4;
+            *--_RNext = _Charconv_digits[_Value & _Mask];
+            _Value >>= _Bits_per_digit;
         } while (_Value != 0);
-        break;
+    } else {
+        const unsigned int _Base_value = static_cast<unsigned int>(_Base != 0 ? _Base : _Dynamic_base);
 
-    case 32:
-        do {
-            *--_RNext = _Charconv_digits[_Value & 0b11111];
-            _Value >>= 5;
-        } while (_Value != 0);
-        break;
+        if (third_party::is_constant_evaluated()) {
+            // the reciprocals only pay off in machine code, constant evaluation is cheaper with one division per digit
+            do {
+                *--_RNext = _Charconv_digits[_Value % _Base_value];
+                _Value    = static_cast<_Unsigned>(_Value / _Base_value);
+            } while (_Value != 0);
+
+            return _End;
+        }
+
+        const _Base_divisor& _Div = _Base_divisors[_Base_value];
+
+        if constexpr (sizeof(_Unsigned) >= 4) {
+            // Split off whole chunks with one real division each, then format every chunk with 32-bit reciprocals.
+            while (_Value >= _Div._Chunk) {
+                const _Unsigned _Quotient = static_cast<_Unsigned>(_Value / _Div._Chunk);
+                unsigned int _Chunk       = static_cast<unsigned int>(_Value - _Quotient * _Div._Chunk);
+                _Value                    = _Quotient;
+
+                for (int _Idx = 0; _Idx != _Div._Chunk_digits; ++_Idx) {
+                    const unsigned int _Chunk_quotient = _Div_by_base(_Chunk, _Div);
+                    *--_RNext                          = _Charconv_digits[_Chunk - _Chunk_quotient * _Base_value];
+                    _Chunk                             = _Chunk_quotient;
+                }
+            }
+        }
+
+        // _Value < _Div._Chunk now, so it is a single 32-bit chunk
+        unsigned int _Trunc = static_cast<unsigned int>(_Value);
 
-    default:
         do {
-            *--_RNext = _Charconv_digits[_Value % _Base];
-            _Value    = static_cast<_Unsigned>(_Value / _Base);
-        } while (_Value != 0);
-        break;
+            const unsigned int _Quotient = _Div_by_base(_Trunc, _Div);
+            *--_RNext                    = _Charconv_digits[_Trunc - _Quotient * _Base_value];
+            _Trunc                       = _Quotient;
+        } while (_Trunc != 0);
+    }
+
+    nstd_assert(_RNext == _First);
+
+    return _End;
+}
+
+// _Base is the base when it is known at compile time,
+// or 0 when it is only known at run time and passed in _Dynamic_base.
+template <int _Base, class _RawTy>
+_NODISCARD constexpr to_chars_result _Integer_to_chars(
+    char* _First, char* const _Last, const _RawTy _Raw_value, [[maybe_unused]] const int _Dynamic_base = _Base) noexcept {
+    static_assert(_Base == 0 || (_Base >= 2 && _Base <= 36), "invalid base in to_chars()");
+    nstd_verify_range(_First, _Last);
+
+    using _Unsigned = std::make_unsigned_t<_RawTy>;
+
+    _Unsigned _Value = static_cast<_Unsigned>(_Raw_value);
+
+    if constexpr (std::is_signed_v<_RawTy>) {
+        if (_Raw_value < 0) {
+            if (_First == _Last) {
+                return {_Last, errc::value_too_large};
+            }
+
+            *_First++ = '-';
+
+            _Value = static_cast<_Unsigned>(0 - _Value);
+        }
     }
 
-    const std::ptrdiff_t _Digits_written = _Buff_end - _RNext;
+    const int _Digits_written = _Integer_length<_Base>(_Value, _Dynamic_base);
 
     if (_Last - _First < _Digits_written) {
         return {_Last, errc::value_too_large};
     }
 
-    //[neargye] constexpr copy chars. P1944 fix this?
-    third_party::trivial_copy(_First, _RNext, static_cast<size_t>(_Digits_written));
+    return {_Write_integer_digits<_Base>(_First, _Value, _Digits_written, _Dynamic_base), errc{}};
+}
+
+template <class _RawTy>
+_NODISCARD constexpr to_chars_result _Integer_to_chars(char* const _First, char* const _Last, const _RawTy _Raw_value, const int _Base) noexcept {
+    nstd_assert_msg(_Base >= 2 && _Base <= 36, "invalid base in to_chars()");
+
+    switch (_Base) {
+    case 10:
+        return _Integer_to_chars<10>(_First, _Last, _Raw_value);
+    case 2:
+        return _Integer_to_chars<2>(_First, _Last, _Raw_value);
+    case 4:
+        return _Integer_to_chars<4>(_First, _Last, _Raw_value);
+    case 8:
+        return _Integer_to_chars<8>(_First, _Last, _Raw_value);
+    case 16:
+        return _Integer_to_chars<16>(_First, _Last, _Raw_value);
+    case 32:
+        return _Integer_to_chars<32>(_First, _Last, _Raw_value);
+    default:
+        return _Integer_to_chars<0>(_First, _Last, _Raw_value, _Base);
+    }
+}
+
+// _Integer_to_chars without any checks, for a destination known to hold the result (e.g. max_chars_v characters).
+template <int _Base, class _RawTy>
+_NODISCARD constexpr char* _Integer_to_chars_unchecked(char* _First, const _RawTy _Raw_value, const int _Dynamic_base = _Base) noexcept {
+    using _Unsigned = std::make_unsigned_t<_RawTy>;
+
+    _Unsigned _Value = static_cast<_Unsigned>(_Raw_value);
+
+    if constexpr (std::is_signed_v<_RawTy>) {
+        if (_Raw_value < 0) {
+            *_First++ = '-';
+
+            _Value = static_cast<_Unsigned>(0 - _Value);
+        }
+    }
+
+    return _Write_integer_digits<_Base>(_First, _Value, _Integer_length<_Base>(_Value, _Dynamic_base), _Dynamic_base);
+}
+
+template <class _RawTy>
+_NODISCARD constexpr char* _Integer_to_chars_unchecked(char* const _First, const _RawTy _Raw_value, const int _Base) noexcept {
+    switch (_Base) {
+    case 10:
+        return _Integer_to_chars_unchecked<10>(_First, _Raw_value);
+    case 2:
+        return _Integer_to_chars_unchecked<2>(_First, _Raw_value);
+    case 4:
+        return _Integer_to_chars_unchecked<4>(_First, _Raw_value);
+    case 8:
+        return _Integer_to_chars_unchecked<8>(_First, _Raw_value);
+    case 16:
+        return _Integer_to_chars_unchecked<16>(_First, _Raw_value);
+    case 32:
+        return _Integer_to_chars_unchecked<32>(_First, _Raw_value);
+    default:
+        return _Integer_to_chars_unchecked<0>(_First, _Raw_value, _Base);
+    }
+}
+
+template <int _Base, class _RawTy>
+_NODISCARD constexpr int _Integer_to_chars_length(const _RawTy _Raw_value, const int _Dynamic_base = _Base) noexcept {
+    // number of characters _Integer_to_chars writes for _Raw_value, including the sign
+    using _Unsigned = std::make_unsigned_t<_RawTy>;
+
+    _Unsigned _Value = static_cast<_Unsigned>(_Raw_value);
+    int _Sign_length = 0;
+
+    if constexpr (std::is_signed_v<_RawTy>) {
+        if (_Raw_value < 0) {
+            _Value       = static_cast<_Unsigned>(0 - _Value);
+            _Sign_length = 1;
+        }
+    }
+
+    return _Sign_length + _Integer_length<_Base>(_Value, _Dynamic_base);
+}
+
+template <class _RawTy>
+_NODISCARD constexpr int _Integer_to_chars_length(const _RawTy _Raw_value, const int _Base) noexcept {
+    nstd_assert_msg(_Base >= 2 && _Base <= 36, "invalid base in to_chars_length()");
+
+    switch (_Base) {
+    case 10:
+        return _Integer_to_chars_length<10>(_Raw_value);
+    case 2:
+        return _Integer_to_chars_length<2>(_Raw_value);
+    case 4:
+        return _Integer_to_chars_length<4>(_Raw_value);
+    case 8:
+        return _Integer_to_chars_length<8>(_Raw_value);
+    case 16:
+        return _Integer_to_chars_length<16>(_Raw_value);
+    case 32:
+        return _Integer_to_chars_length<32>(_Raw_value);
+    default:
+        return _Integer_to_chars_length<0>(_Raw_value, _Base);
+    }
+}
+
+template <class _RawTy, int _Base>
+_NODISCARD constexpr int _Integer_to_chars_max_length() noexcept {
+    static_assert(std::is_integral_v<_RawTy> && !std::is_same_v<std::remove_cv_t<_RawTy>, bool>,
+        "max_chars_v requires an integral type other than bool");
+    static_assert(_Base >= 2 && _Base <= 36, "invalid base in max_chars_v");
 
-    return {_First + _Digits_written, errc{}};
+    const int _Min_length = _Integer_to_chars_length<_Base>((std::numeric_limits<_RawTy>::min)());
+    const int _Max_length = _Integer_to_chars_length<_Base>((std::numeric_limits<_RawTy>::max)());
+    return _Min_length > _Max_length ? _Min_length : _Max_length;
 }
 
 } // namespace nstd
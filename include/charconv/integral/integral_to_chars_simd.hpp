@@ -0,0 +1,188 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019-2020 Daniil Goncharov <neargye@gmail.com>, Karaev Alexander <akaraevz@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Runtime-only kernels for _Integer_to_chars. They are not constexpr; callers must only reach them when
+// !third_party::is_constant_evaluated().
+
+#pragma once
+
+#include <cstring>
+
+#include "charconv/detail/detail.hpp"
+#include "charconv/detail/simd.hpp"
+
+namespace nstd {
+
+#if NSTD_CHARCONV_SSE2
+
+// Converts _Value < 10^8 to eight decimal digits, one per 16-bit lane, most significant first.
+// Derived from Milo Yip's itoa-benchmark (u64toa_sse2).
+inline __m128i _Convert_8_digits_sse2(const unsigned int _Value) noexcept {
+    // abcd, efgh = abcdefgh divmod 10000
+    const __m128i _Abcdefgh = _mm_cvtsi32_si128(static_cast<int>(_Value));
+    const __m128i _Abcd     = _mm_srli_epi64(_mm_mul_epu32(_Abcdefgh, _mm_set1_epi32(static_cast<int>(0xD1B7'1759U))), 45);
+    const __m128i _Efgh     = _mm_sub_epi32(_Abcdefgh, _mm_mul_epu32(_Abcd, _mm_set1_epi32(10'000)));
+
+    // [abcd * 4, abcd * 4, abcd * 4, abcd * 4, efgh * 4, efgh * 4, efgh * 4, efgh * 4]
+    const __m128i _V1  = _mm_slli_epi64(_mm_unpacklo_epi16(_Abcd, _Efgh), 2);
+    const __m128i _V2a = _mm_unpacklo_epi16(_V1, _V1);
+    const __m128i _V2  = _mm_unpacklo_epi32(_V2a, _V2a);
+
+    // divide by 10^3, 10^2, 10^1, 10^0 with multiply-high: [a, ab, abc, abcd, e, ef, efg, efgh]
+    const __m128i _V3 = _mm_mulhi_epu16(_V2, _mm_setr_epi16(8389, 5243, 13108, -32768, 8389, 5243, 13108, -32768));
+    const __m128i _V4 =
+        _mm_mulhi_epu16(_V3, _mm_setr_epi16(1 << 7, 1 << 11, 1 << 13, -32768, 1 << 7, 1 << 11, 1 << 13, -32768));
+
+    // [a, ab, abc, abcd, ...] - 10 * [0, a, ab, abc, ...] = [a, b, c, d, e, f, g, h]
+    const __m128i _V5 = _mm_mullo_epi16(_V4, _mm_set1_epi16(10));
+    const __m128i _V6 = _mm_slli_epi64(_V5, 16);
+    return _mm_sub_epi16(_V4, _V6);
+}
+
+// Converts _Value < 10^16 to sixteen ASCII digits, most significant first.
+inline __m128i _Convert_16_digits_sse2(const unsigned long long _Value) noexcept {
+    const unsigned int _High = static_cast<unsigned int>(_Value / 100'000'000);
+    const unsigned int _Low  = static_cast<unsigned int>(_Value - _High * 100'000'000ULL);
+
+    const __m128i _Digits = _mm_packus_epi16(_Convert_8_digits_sse2(_High), _Convert_8_digits_sse2(_Low));
+    return _mm_add_epi8(_Digits, _mm_set1_epi8('0'));
+}
+
+// Writes the _Digits_written (13 to 20) decimal digits of _Value to [_First, _First + _Digits_written).
+// Only used on 64-bit targets, where the 64-bit divisions are single instructions.
+inline void _Write_decimal_sse2(char* const _First, unsigned long long _Value, const int _Digits_written) noexcept {
+    if (_Digits_written > 16) {
+        unsigned int _Top = static_cast<unsigned int>(_Value / 10'000'000'000'000'000ULL);
+        _Value -= _Top * 10'000'000'000'000'000ULL;
+
+        char* _RNext = _First + (_Digits_written - 16);
+        while (_Top >= 10) {
+            const unsigned int _Pair = _Top % 100 * 2;
+            _Top /= 100;
+            *--_RNext = _Digit_pairs[_Pair + 1];
+            *--_RNext = _Digit_pairs[_Pair];
+        }
+        if (_RNext != _First) {
+            *--_RNext = static_cast<char>('0' + _Top);
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(_First + (_Digits_written - 16)), _Convert_16_digits_sse2(_Value));
+    } else {
+        alignas(16) char _Buff[16];
+        _mm_store_si128(reinterpret_cast<__m128i*>(_Buff), _Convert_16_digits_sse2(_Value));
+        std::memcpy(_First, _Buff + (16 - _Digits_written), static_cast<std::size_t>(_Digits_written));
+    }
+}
+
+// Converts _Value to sixteen lowercase hexadecimal digits, most significant first.
+inline __m128i _Convert_16_hex_digits_sse2(const unsigned long long _Value) noexcept {
+    // bytes in memory order, which is least significant first on x86
+    const __m128i _Bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&_Value));
+    const __m128i _Mask  = _mm_set1_epi8(0x0F);
+
+    // one nibble per byte, the high nibble of each source byte first
+    __m128i _Nibbles = _mm_unpacklo_epi8(_mm_and_si128(_mm_srli_epi16(_Bytes, 4), _Mask), _mm_and_si128(_Bytes, _Mask));
+
+    // reverse the order of the source bytes (now 16-bit lanes) to put the most significant nibble first
+    _Nibbles = _mm_shufflelo_epi16(_Nibbles, 0x1B);
+    _Nibbles = _mm_shufflehi_epi16(_Nibbles, 0x1B);
+    _Nibbles = _mm_shuffle_epi32(_Nibbles, 0x4E);
+
+#if NSTD_CHARCONV_SSSE3
+    return _mm_shuffle_epi8(_mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'), _Nibbles);
+#else
+    // '0' + n, plus the distance from '9' + 1 to 'a' for n > 9
+    const __m128i _Letters = _mm_and_si128(_mm_cmpgt_epi8(_Nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+    return _mm_add_epi8(_mm_add_epi8(_Nibbles, _mm_set1_epi8('0')), _Letters);
+#endif
+}
+
+// Writes the _Digits_written (1 to 16) hexadecimal digits of _Value to [_First, _First + _Digits_written).
+inline void _Write_hex_sse2(char* const _First, const unsigned long long _Value, const int _Digits_written) noexcept {
+    // leading zeros come out of the conversion too; _Digits_written (from countl_zero) says how many to drop
+    alignas(16) char _Buff[16];
+    _mm_store_si128(reinterpret_cast<__m128i*>(_Buff), _Convert_16_hex_digits_sse2(_Value));
+    std::memcpy(_First, _Buff + (16 - _Digits_written), static_cast<std::size_t>(_Digits_written));
+}
+
+#endif // NSTD_CHARCONV_SSE2
+
+#if NSTD_CHARCONV_LITTLE_ENDIAN
+
+inline unsigned long long _Byteswap64(const unsigned long long _Val) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return _byteswap_uint64(_Val);
+#else
+    return __builtin_bswap64(_Val);
+#endif
+}
+
+// Spreads the low 8 * _Bits_per_digit bits of _Bits into eight bytes, one digit per byte,
+// the most significant digit in the lowest byte (i.e. first in memory).
+template <int _Bits_per_digit>
+inline unsigned long long _Spread_digits(const unsigned long long _Bits) noexcept {
+    static_assert(_Bits_per_digit == 1 || _Bits_per_digit == 3);
+
+#if NSTD_CHARCONV_BMI2
+    constexpr unsigned long long _Digit_mask = (1U << _Bits_per_digit) - 1;
+    return _Byteswap64(_pdep_u64(_Bits, 0x0101'0101'0101'0101U * _Digit_mask));
+#else
+    if constexpr (_Bits_per_digit == 1) {
+        // copies of the byte 9 bits apart put bit 7 - k at the top of byte k
+        return ((_Bits & 0xFF) * 0x8040'2010'0804'0201U >> 7) & 0x0101'0101'0101'0101U;
+    } else {
+        // halve the groups of digits until each one has a byte, then put the first digit first
+        unsigned long long _Spread = _Bits & 0xFF'FFFF;
+        _Spread                    = (_Spread | _Spread << 20) & 0x0000'0FFF'0000'0FFFU;
+        _Spread                    = (_Spread | _Spread << 10) & 0x003F'003F'003F'003FU;
+        _Spread                    = (_Spread | _Spread << 5) & 0x0707'0707'0707'0707U;
+        return _Byteswap64(_Spread);
+    }
+#endif
+}
+
+// Writes the _Digits_written binary (_Bits_per_digit == 1) or octal (3) digits of _Value
+// to [_First, _First + _Digits_written), eight at a time.
+template <int _Bits_per_digit>
+inline void _Write_spread_digits(char* const _First, unsigned long long _Value, const int _Digits_written) noexcept {
+    constexpr unsigned long long _Zeros = 0x3030'3030'3030'3030U;
+
+    char* _RNext = _First + _Digits_written;
+    while (_RNext - _First >= 8) {
+        _RNext -= 8;
+        const unsigned long long _Chars = _Spread_digits<_Bits_per_digit>(_Value) + _Zeros;
+        std::memcpy(_RNext, &_Chars, 8);
+        _Value >>= 8 * _Bits_per_digit;
+    }
+
+    if (_RNext != _First) {
+        // the remaining digits are the tail of eight, the rest of which are leading zeros
+        const unsigned long long _Chars = _Spread_digits<_Bits_per_digit>(_Value) + _Zeros;
+        char _Buff[8];
+        std::memcpy(_Buff, &_Chars, 8);
+        std::memcpy(_First, _Buff + (8 - (_RNext - _First)), static_cast<std::size_t>(_RNext - _First));
+    }
+}
+
+#endif // NSTD_CHARCONV_LITTLE_ENDIAN
+
+} // namespace nstd
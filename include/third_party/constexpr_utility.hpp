@@ -24,11 +24,39 @@
 
 #include <cstddef>
 #include <cstring>
+#include <type_traits>
+
+// THIRD_PARTY_HAS_IS_CONSTANT_EVALUATED is 1 when is_constant_evaluated() can tell constant evaluation from runtime.
+// Without it is_constant_evaluated() always returns true, so callers stay constexpr but never take runtime-only paths.
+#if defined(__cpp_if_consteval) || defined(__cpp_lib_is_constant_evaluated)
+#define THIRD_PARTY_HAS_IS_CONSTANT_EVALUATED 1
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define THIRD_PARTY_HAS_IS_CONSTANT_EVALUATED 1
+#define THIRD_PARTY_BUILTIN_IS_CONSTANT_EVALUATED 1
+#endif
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+// the builtin is there in C++17 mode too, GCC 9 just has no __has_builtin to report it
+#define THIRD_PARTY_HAS_IS_CONSTANT_EVALUATED 1
+#define THIRD_PARTY_BUILTIN_IS_CONSTANT_EVALUATED 1
+#endif
+
+#if !defined(THIRD_PARTY_HAS_IS_CONSTANT_EVALUATED)
+#define THIRD_PARTY_HAS_IS_CONSTANT_EVALUATED 0
+#endif
 
 namespace third_party {
 
 inline constexpr bool is_constant_evaluated() noexcept {
-#if defined(__cpp_lib_is_constant_evaluated)
+#if defined(__cpp_if_consteval)
+    if consteval {
+        return true;
+    } else {
+        return false;
+    }
+#elif defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+#elif defined(THIRD_PARTY_BUILTIN_IS_CONSTANT_EVALUATED)
     return __builtin_is_constant_evaluated();
 #else
     return true;
@@ -1,3 +1,5 @@
+// constexpr ops budget: 16000000
+// constexpr steps budget: 2400000
 #include "../test.cxx"
 
 constexpr auto _test_int = (test_integer<int>(), true);
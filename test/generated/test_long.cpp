@@ -1,3 +1,5 @@
+// constexpr ops budget: 24000000
+// constexpr steps budget: 3600000
 #include "../test.cxx"
 
 constexpr auto _test_long = (test_integer<long>(), true);
@@ -1,3 +1,5 @@
+// constexpr ops budget: 2000000
+// constexpr steps budget: 100000
 #include "../test.cxx"
 
 constexpr auto _test_overflow = []{
@@ -19,6 +21,21 @@ constexpr auto _test_overflow = []{
     test_from_chars<int>("-2147483648", 10, 11, errc{}, -2147483647 - 1); // risky with max digit
     test_from_chars<int>("-2147483649", 10, 11, out_ran); // risky with bad digit
     test_from_chars<int>("-2147483650", 10, 11, out_ran); // beyond risky
+
+    // Test that leading zeros don't count towards the digit limit.
+    test_from_chars<unsigned int>("0004294967295", 10, 13, errc{}, 4294967295U); // risky with max digit
+    test_from_chars<unsigned int>("0004294967296", 10, 13, out_ran); // risky with bad digit
+    test_from_chars<unsigned int>("42949672950", 10, 11, out_ran); // one digit too many
+    test_from_chars<int>("-0002147483648", 10, 14, errc{}, -2147483647 - 1); // risky with max digit
+    test_from_chars<unsigned long long>("000ffffffffffffffff", 16, 19, errc{}, 18446744073709551615ULL); // max digits
+    test_from_chars<unsigned long long>("10000000000000000", 16, 17, out_ran); // one digit too many
+    test_from_chars<long long>("-8000000000000000", 16, 17, errc{}, -9223372036854775807LL - 1); // max digits
+    test_from_chars<long long>("8000000000000000", 16, 16, out_ran); // risky with bad digit
+    test_from_chars<unsigned long long>("1777777777777777777777", 8, 22, errc{}, 18446744073709551615ULL); // 64 bits
+    test_from_chars<unsigned long long>("2000000000000000000000", 8, 22, out_ran); // 65 bits
+    test_from_chars<signed char>("-10000000", 2, 9, errc{}, static_cast<signed char>(-128)); // |min| has 8 bits
+    test_from_chars<signed char>("-10000001", 2, 9, out_ran); // beyond |min|
+    test_from_chars<signed char>("10000000", 2, 8, out_ran); // max has 7 bits
     return true;
 }();
 
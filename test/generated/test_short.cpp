@@ -1,3 +1,5 @@
+// constexpr ops budget: 11000000
+// constexpr steps budget: 1700000
 #include "../test.cxx"
 
 constexpr auto _test_short = (test_integer<short>(), true);
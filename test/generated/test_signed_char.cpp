@@ -1,3 +1,5 @@
+// constexpr ops budget: 8000000
+// constexpr steps budget: 1200000
 #include "../test.cxx"
 
 constexpr auto _test_signed_char = (test_integer<signed char>(), true);
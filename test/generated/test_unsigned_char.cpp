@@ -1,3 +1,5 @@
+// constexpr ops budget: 6000000
+// constexpr steps budget: 900000
 #include "../test.cxx"
 
 constexpr auto _test_unsigned_char = (test_integer<unsigned char>(), true);
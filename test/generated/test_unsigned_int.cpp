@@ -1,3 +1,5 @@
+// constexpr ops budget: 11000000
+// constexpr steps budget: 1800000
 #include "../test.cxx"
 
 constexpr auto _test_unsigned_int = (test_integer<unsigned int>(), true);
@@ -1,3 +1,5 @@
+// constexpr ops budget: 18000000
+// constexpr steps budget: 2600000
 #include "../test.cxx"
 
 constexpr auto _test_unsigned_long_long = (test_integer<unsigned long long>(), true);
@@ -1,3 +1,5 @@
+// constexpr ops budget: 8000000
+// constexpr steps budget: 1300000
 #include "../test.cxx"
 
 constexpr auto _test_unsigned_short = (test_integer<unsigned short>(), true);
@@ -4,6 +4,8 @@
 // Changes
 // * replace std::array<T>::fill with third_party::trivial_fill
 // * replace std::string with std::array
+// * fill and check the buffer of test_common_to_chars in time linear in the output size, to reduce the constant
+//   evaluation cost
 
 #include <algorithm>
 #include <array>
@@ -21,6 +23,16 @@
 using namespace std;
 using namespace nstd;
 
+template <size_t N>
+constexpr array<char, N> make_filled_buffer() {
+    array<char, N> buff{};
+    third_party::trivial_fill(buff.data(), '@', buff.size());
+    return buff;
+}
+
+template <size_t N>
+constexpr array<char, N> filled_buffer = make_filled_buffer<N>();
+
 template <typename T, typename Optional>
 constexpr void test_common_to_chars(
     const T value, const Optional opt_arg, const optional<int> opt_precision, const string_view correct) {
@@ -43,7 +55,8 @@ constexpr void test_common_to_chars(
 
     constexpr size_t BufferSuffix = 30; // detect buffer overruns (specific value isn't important)
 
-    array<char, BufferPrefix + Space + BufferSuffix> buff;
+    // copying a buffer that was filled once per size is far cheaper in constant evaluation than filling it again
+    array<char, BufferPrefix + Space + BufferSuffix> buff = filled_buffer<BufferPrefix + Space + BufferSuffix>;
 
     char* const buff_begin = buff.data();
     char* const first      = buff_begin + BufferPrefix;
@@ -53,12 +66,22 @@ constexpr void test_common_to_chars(
     static_assert(ExtraChars + 10 < BufferSuffix,
         "The specific values aren't important, but there should be plenty of room to detect buffer overruns.");
 
+    const auto is_fill_char = [](const char c) { return c == '@'; };
+
+    // The buffer is filled once. A failed call may leave anything in [first, last), so nothing needs to be filled
+    // again until the successful calls, whose digits must not come from an earlier iteration. A stray write at or past
+    // last stays visible until the iteration whose last reaches it, which checks that byte; everything past the last
+    // iteration's range and in front of first is checked once at the end. Together that catches every stray write
+    // while keeping the cost linear in correct.size().
+    char* const checked_last = first + correct.size() + ExtraChars;
+
     for (size_t n = 0; n <= correct.size() + ExtraChars; ++n) {
         assert(n <= static_cast<size_t>(buff_end - first));
         char* const last = first + n;
 
-        third_party::trivial_fill(buff.data(), '@', buff.size());
-        const auto is_fill_char = [](const char c) { return c == '@'; };
+        if (n >= correct.size()) {
+            third_party::trivial_fill(first, '@', n);
+        }
 
         to_chars_result result{};
         if (opt_precision.has_value()) {
@@ -78,17 +101,22 @@ constexpr void test_common_to_chars(
         if (n < correct.size()) {
             assert(result.ptr == last);
             assert(result.ec == errc::value_too_large);
-            assert(all_of(buff_begin, first, is_fill_char));
             // [first, last) is unspecified
-            assert(all_of(last, buff_end, is_fill_char));
+            assert(is_fill_char(*last));
         } else {
             assert(result.ptr == first + correct.size());
             assert(result.ec == errc{});
-            assert(all_of(buff_begin, first, is_fill_char));
             assert(equal(first, result.ptr, correct.begin(), correct.end()));
-            assert(all_of(result.ptr, buff_end, is_fill_char));
+            assert(all_of(result.ptr, checked_last, is_fill_char));
         }
     }
+
+    for (const char* p = buff_begin; p != first; ++p) {
+        assert(is_fill_char(*p));
+    }
+    for (const char* p = checked_last; p != buff_end; ++p) {
+        assert(is_fill_char(*p));
+    }
 }
 
 template <typename T>
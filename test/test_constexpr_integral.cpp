@@ -30,6 +30,8 @@ namespace proposal = nstd;
 #include <array>
 #include <cstring>
 #include <iterator>
+#include <limits>
+#include <string_view>
 
 TEST_CASE("[to_chars] int") {
     auto test = []() constexpr -> bool {
@@ -59,3 +61,232 @@ TEST_CASE("[from_chars] int") {
     static_assert(test_from_chars_int);
     REQUIRE(test());
 }
+
+TEST_CASE("[to_chars] template base") {
+    auto test = []() constexpr -> bool {
+        std::array<char, 10> str = {};
+        if (auto [p, ec] = proposal::to_chars<16>(str.data(), str.data() + str.size(), -255); ec == std::errc{}) {
+            return p == str.data() + 3 && str[0] == '-' && str[1] == 'f' && str[2] == 'f';
+        }
+        return false;
+    };
+
+    constexpr auto test_to_chars_template_base = test();
+    static_assert(test_to_chars_template_base);
+    REQUIRE(test());
+}
+
+TEST_CASE("[from_chars] template base") {
+    auto test = []() constexpr -> bool {
+        std::array<char, 10> str{"-zz"};
+        int result = -1;
+        if (auto [p, ec] = proposal::from_chars<36>(str.data(), str.data() + str.size(), result); ec == std::errc{}) {
+            return p == str.data() + 3 && result == -1295;
+        }
+        return false;
+    };
+
+    constexpr auto test_from_chars_template_base = test();
+    static_assert(test_from_chars_template_base);
+    REQUIRE(test());
+}
+
+TEST_CASE("[to_chars_length] int") {
+    auto test = []() constexpr -> bool {
+        return proposal::to_chars_length(0) == 1 && proposal::to_chars_length(-42) == 3 &&
+               proposal::to_chars_length(1000, 10) == 4 && proposal::to_chars_length(-255, 16) == 3 &&
+               proposal::to_chars_length(35, 36) == 1 && proposal::to_chars_length(36, 36) == 2;
+    };
+
+    constexpr auto test_to_chars_length_int = test();
+    static_assert(test_to_chars_length_int);
+    REQUIRE(test());
+}
+
+TEST_CASE("[to_chars_length] powers of the base") {
+    // base^k - 1 is the largest value with k digits, base^k the smallest with k + 1
+    constexpr auto test = [] {
+        for (int base = 2; base <= 36; ++base) {
+            const auto b = static_cast<unsigned long long>(base);
+            int digits   = 1;
+            for (unsigned long long pow = b;; pow *= b, ++digits) {
+                if (proposal::to_chars_length(pow - 1, base) != digits ||
+                    proposal::to_chars_length(pow, base) != digits + 1) {
+                    return false;
+                }
+                if (pow > (std::numeric_limits<unsigned long long>::max)() / b) {
+                    break;
+                }
+            }
+        }
+        return true;
+    };
+
+    constexpr auto test_to_chars_length_powers = test();
+    static_assert(test_to_chars_length_powers);
+    REQUIRE(test());
+}
+
+TEST_CASE("[max_chars_v]") {
+    static_assert(proposal::max_chars_v<signed char, 2> == 9);
+    static_assert(proposal::max_chars_v<unsigned char> == 3);
+    static_assert(proposal::max_chars_v<int> == 11);
+    static_assert(proposal::max_chars_v<long long, 2> == 65);
+    static_assert(proposal::max_chars_v<unsigned long long> == 20);
+    static_assert(proposal::max_chars_v<unsigned long long, 36> == 13);
+    REQUIRE(proposal::max_chars_v<int, 16> == 9);
+}
+
+TEST_CASE("[to_chars_array]") {
+    constexpr auto answer = proposal::to_chars_array<42>();
+    static_assert(answer.size() == 2 && answer[0] == '4' && answer[1] == '2');
+
+    constexpr auto negative_hex = proposal::to_chars_array<static_cast<short>(-255), 16>();
+    static_assert(negative_hex.size() == 3 && negative_hex[0] == '-' && negative_hex[1] == 'f' && negative_hex[2] == 'f');
+
+    constexpr auto zero = proposal::to_chars_array<0ULL, 2>();
+    static_assert(zero.size() == 1 && zero[0] == '0');
+
+    constexpr auto max = proposal::to_chars_array<(std::numeric_limits<unsigned long long>::max)(), 36>();
+    static_assert(max.size() == proposal::max_chars_v<unsigned long long, 36>);
+    REQUIRE(std::string_view(max.data(), max.size()) == "3w5e11264sgsf");
+}
+
+TEST_CASE("[to_chars_unchecked] [from_chars_unchecked] int") {
+    auto test = []() constexpr -> bool {
+        std::array<char, proposal::max_chars_v<int, 16>> str = {};
+        char* const end = proposal::to_chars_unchecked(str.data(), -255, 16);
+        int result      = 0;
+        proposal::from_chars_unchecked(str.data(), end, result, 16);
+        return end == str.data() + 3 && str[0] == '-' && str[1] == 'f' && str[2] == 'f' && result == -255;
+    };
+
+    constexpr auto test_unchecked_int = test();
+    static_assert(test_unchecked_int);
+    REQUIRE(test());
+}
+
+TEST_CASE("[from_chars_fixed] int") {
+    auto test = []() constexpr -> bool {
+        std::array<char, 11> str{"2020-01-31"};
+        int year = 0, month = 0, day = 0;
+        const auto [p1, ec1] = proposal::from_chars_fixed<4>(str.data(), str.data() + 10, year);
+        const auto [p2, ec2] = proposal::from_chars_fixed<2>(str.data() + 5, str.data() + 10, month);
+        const auto [p3, ec3] = proposal::from_chars_fixed<2>(str.data() + 8, str.data() + 10, day);
+        const auto [p4, ec4] = proposal::from_chars_fixed<5>(str.data(), str.data() + 10, year);
+        return ec1 == std::errc{} && ec2 == std::errc{} && ec3 == std::errc{} && p3 == str.data() + 10 &&
+               year == 2020 && month == 1 && day == 31 && ec4 == std::errc::invalid_argument && p4 == str.data();
+    };
+
+    constexpr auto test_from_chars_fixed_int = test();
+    static_assert(test_from_chars_fixed_int);
+    REQUIRE(test());
+}
+
+namespace {
+
+// Everything to_chars and from_chars produce for one value in one base, so that the results of the constexpr and the
+// runtime implementations can be compared as a whole.
+struct path_result {
+    std::array<char, 72> chars{};
+    std::ptrdiff_t size           = 0;
+    long long parsed              = 0;
+    std::ptrdiff_t parsed_size    = 0;
+    long long padded_zeros_parsed = 0;
+    bool ok                       = false;
+
+    constexpr bool operator==(const path_result& other) const {
+        for (std::size_t i = 0; i < chars.size(); ++i) {
+            if (chars[i] != other.chars[i]) {
+                return false;
+            }
+        }
+        return size == other.size && parsed == other.parsed && parsed_size == other.parsed_size &&
+               padded_zeros_parsed == other.padded_zeros_parsed && ok == other.ok;
+    }
+};
+
+template <typename T>
+constexpr std::array<T, 14> path_values() {
+    // boundaries and long values, so that both the short scalar tails and the wide runtime kernels get used
+    return {static_cast<T>(0), static_cast<T>(1), static_cast<T>(9), static_cast<T>(10), static_cast<T>(255),
+        static_cast<T>(256), static_cast<T>(65'535), static_cast<T>(0xFFFF'FFFFULL), static_cast<T>(1'000'000'000'000ULL),
+        static_cast<T>(9'999'999'999'999ULL), static_cast<T>(0x0123'4567'89AB'CDEFULL), static_cast<T>(-1),
+        (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)()};
+}
+
+template <typename T>
+constexpr std::array<path_result, 14 * 35> run_paths() {
+    std::array<path_result, 14 * 35> results{};
+    const auto values = path_values<T>();
+
+    std::size_t idx = 0;
+    for (const T value : values) {
+        for (int base = 2; base <= 36; ++base, ++idx) {
+            path_result& result = results[idx];
+
+            const auto [end, ec] = proposal::to_chars(result.chars.data(), result.chars.data() + result.chars.size(), value, base);
+            result.size          = end - result.chars.data();
+
+            T parsed              = 0;
+            const auto [ptr, ec2] = proposal::from_chars(result.chars.data(), end, parsed, base);
+            result.parsed         = static_cast<long long>(parsed);
+            result.parsed_size    = ptr - result.chars.data();
+
+            // the same digits behind 20 leading zeros
+            std::array<char, 100> zeros{};
+            std::size_t pos = 0;
+            std::size_t src = 0;
+            if (result.chars[0] == '-') {
+                zeros[pos++] = '-';
+                ++src;
+            }
+            for (int i = 0; i < 20; ++i) {
+                zeros[pos++] = '0';
+            }
+            for (; src < static_cast<std::size_t>(result.size); ++src) {
+                zeros[pos++] = result.chars[src];
+            }
+            T zeros_parsed             = 0;
+            const auto zeros_res       = proposal::from_chars(zeros.data(), zeros.data() + pos, zeros_parsed, base);
+            result.padded_zeros_parsed = static_cast<long long>(zeros_parsed);
+
+            result.ok = ec == std::errc{} && ec2 == std::errc{} && zeros_res.ec == std::errc{} &&
+                        zeros_res.ptr == zeros.data() + pos && parsed == value && zeros_parsed == value;
+        }
+    }
+    return results;
+}
+
+template <typename T>
+void check_paths() {
+    constexpr auto constexpr_results = run_paths<T>();
+    for (const path_result& result : constexpr_results) {
+        REQUIRE(result.ok);
+    }
+
+    // not a constant expression, so to_chars and from_chars take their runtime implementations
+    const auto runtime_results = run_paths<T>();
+    for (std::size_t i = 0; i < runtime_results.size(); ++i) {
+        REQUIRE(runtime_results[i] == constexpr_results[i]);
+    }
+}
+
+} // namespace
+
+TEST_CASE("[to_chars] [from_chars] constexpr and runtime paths agree") {
+    static_assert(third_party::is_constant_evaluated());
+    REQUIRE(third_party::is_constant_evaluated() == !THIRD_PARTY_HAS_IS_CONSTANT_EVALUATED);
+
+    check_paths<char>();
+    check_paths<signed char>();
+    check_paths<unsigned char>();
+    check_paths<short>();
+    check_paths<unsigned short>();
+    check_paths<int>();
+    check_paths<unsigned int>();
+    check_paths<long>();
+    check_paths<unsigned long>();
+    check_paths<long long>();
+    check_paths<unsigned long long>();
+}
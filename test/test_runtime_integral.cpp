@@ -0,0 +1,364 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019-2020 Daniil Goncharov <neargye@gmail.com>, Karaev Alexander <akaraevz@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Runs the MS STL test vectors outside of constant evaluation, where to_chars and from_chars may take the
+// runtime-only kernels, and cross-checks random values against a naive reference implementation.
+
+// The shared test vectors in test.cxx check with assert, which must not be compiled out here.
+#undef NDEBUG
+
+#include "test.cxx"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+// Unlike assert, checks in every configuration, and reports the case being tested.
+#define CHECK(...)                                                                                                   \
+    do {                                                                                                             \
+        if (!(__VA_ARGS__)) {                                                                                        \
+            std::fprintf(stderr, "%s:%d: check failed: %s, for %s\n", __FILE__, __LINE__, #__VA_ARGS__,              \
+                check_case.c_str());                                                                                 \
+            std::abort();                                                                                            \
+        }                                                                                                            \
+    } while (false)
+
+namespace {
+
+// what the random tests are checking at the moment, for CHECK to report
+std::string check_case;
+
+template <typename T>
+std::string describe_value(const T value, const int base) {
+    return "value " + std::to_string(value) + " in base " + std::to_string(base);
+}
+
+std::string describe_input(const std::vector<char>& input, const int base) {
+    return "input \"" + std::string(input.begin(), input.end()) + "\" in base " + std::to_string(base);
+}
+
+template <typename T>
+std::string reference_to_chars(const T value, const int base) {
+    using U = make_unsigned_t<T>;
+
+    U abs_value = static_cast<U>(value);
+    if constexpr (is_signed_v<T>) {
+        if (value < 0) {
+            abs_value = static_cast<U>(0 - abs_value);
+        }
+    }
+
+    std::string digits;
+    do {
+        digits.insert(digits.begin(), "0123456789abcdefghijklmnopqrstuvwxyz"[abs_value % base]);
+        abs_value = static_cast<U>(abs_value / base);
+    } while (abs_value != 0);
+
+    if constexpr (is_signed_v<T>) {
+        if (value < 0) {
+            digits.insert(digits.begin(), '-');
+        }
+    }
+    return digits;
+}
+
+template <typename T>
+void reference_from_chars(const std::vector<char>& input, const int base, size_t& correct_idx, errc& correct_ec,
+    optional<T>& correct_value) {
+    size_t idx = 0;
+    bool minus = false;
+    if (is_signed_v<T> && idx < input.size() && input[idx] == '-') {
+        minus = true;
+        ++idx;
+    }
+
+    // |T's most negative value| fits in uint64_t, so track the magnitude there and stop growing it once too big.
+    const uint64_t limit = minus ? static_cast<uint64_t>(numeric_limits<T>::max()) + 1
+                                 : static_cast<uint64_t>(numeric_limits<T>::max());
+    uint64_t magnitude   = 0;
+    bool overflowed      = false;
+
+    const size_t digits_begin = idx;
+    for (; idx < input.size(); ++idx) {
+        const char c = input[idx];
+        int digit    = 36;
+        if (c >= '0' && c <= '9') {
+            digit = c - '0';
+        } else if (c >= 'a' && c <= 'z') {
+            digit = c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'Z') {
+            digit = c - 'A' + 10;
+        }
+        if (digit >= base) {
+            break;
+        }
+
+        if (!overflowed) {
+            if (magnitude > (limit - static_cast<uint64_t>(digit)) / static_cast<uint64_t>(base)) {
+                overflowed = true;
+            } else {
+                magnitude = magnitude * static_cast<uint64_t>(base) + static_cast<uint64_t>(digit);
+            }
+        }
+    }
+
+    if (idx == digits_begin) {
+        correct_idx = 0;
+        correct_ec  = errc::invalid_argument;
+        correct_value.reset();
+    } else if (overflowed) {
+        correct_idx = idx;
+        correct_ec  = errc::result_out_of_range;
+        correct_value.reset();
+    } else {
+        correct_idx = idx;
+        correct_ec  = errc{};
+        correct_value = minus ? static_cast<T>(0 - magnitude) : static_cast<T>(magnitude);
+    }
+}
+
+template <typename T>
+T random_value(std::mt19937_64& gen) {
+    // uniform over the bit width, so that every digit count shows up
+    const int bits = static_cast<int>(gen() % (numeric_limits<make_unsigned_t<T>>::digits + 1));
+    const uint64_t raw = bits == 0 ? 0 : gen() >> (64 - bits);
+    return static_cast<T>(raw);
+}
+
+template <typename T>
+void test_random_to_chars(std::mt19937_64& gen) {
+    for (int base = 2; base <= 36; ++base) {
+        for (int i = 0; i < 2000; ++i) {
+            const T value            = random_value<T>(gen);
+            const std::string correct = reference_to_chars(value, base);
+            check_case                = describe_value(value, base);
+
+            // exactly sized destination, so that any overrun would be outside of the allocation
+            std::vector<char> buff(correct.size());
+            const auto [ptr, ec] = nstd::to_chars(buff.data(), buff.data() + buff.size(), value, base);
+            CHECK(ec == errc{});
+            CHECK(ptr == buff.data() + buff.size());
+            CHECK(std::string(buff.begin(), buff.end()) == correct);
+            CHECK(nstd::to_chars_length(value, base) == static_cast<int>(correct.size()));
+
+            std::vector<char> unchecked(correct.size());
+            CHECK(nstd::to_chars_unchecked(unchecked.data(), value, base) == unchecked.data() + unchecked.size());
+            CHECK(unchecked == buff);
+
+            T parsed = 0;
+            nstd::from_chars_unchecked(buff.data(), buff.data() + buff.size(), parsed, base);
+            CHECK(parsed == value);
+
+            std::vector<char> small(correct.size() - 1);
+            const auto small_res = nstd::to_chars(small.data(), small.data() + small.size(), value, base);
+            CHECK(small_res.ec == errc::value_too_large);
+            CHECK(small_res.ptr == small.data() + small.size());
+        }
+    }
+}
+
+template <typename T>
+void test_random_from_chars(std::mt19937_64& gen) {
+    constexpr char alphabet[] = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+    for (int base = 2; base <= 36; ++base) {
+        for (int i = 0; i < 2000; ++i) {
+            std::vector<char> input;
+            if (gen() % 4 == 0) {
+                input.push_back('-');
+            }
+            const size_t zeros = gen() % 4 == 0 ? gen() % 20 : 0;
+            input.insert(input.end(), zeros, '0');
+
+            const size_t digits = gen() % 70;
+            for (size_t d = 0; d < digits; ++d) {
+                const size_t digit = gen() % static_cast<size_t>(base);
+                input.push_back(digit >= 10 && gen() % 2 == 0 ? alphabet[digit + 26] : alphabet[digit]);
+            }
+            if (gen() % 2 == 0) {
+                input.push_back(static_cast<char>(gen() % 256));
+                input.insert(input.end(), gen() % 20, '1');
+            }
+
+            size_t correct_idx;
+            errc correct_ec;
+            optional<T> correct_value;
+            check_case = describe_input(input, base);
+            reference_from_chars<T>(input, base, correct_idx, correct_ec, correct_value);
+
+            constexpr T unmodified = 111;
+            T dest                 = unmodified;
+            const auto [ptr, ec]   = nstd::from_chars(input.data(), input.data() + input.size(), dest, base);
+            CHECK(ptr == input.data() + correct_idx);
+            CHECK(ec == correct_ec);
+            CHECK(dest == correct_value.value_or(unmodified));
+
+            // digits in the padding would show up in the result if the padded kernels parsed past the end
+            std::vector<char> padded(input);
+            for (size_t p = 0; p < nstd::from_chars_padding; ++p) {
+                padded.push_back(gen() % 8 == 0 ? static_cast<char>(gen() % 256) : '1');
+            }
+            T padded_dest         = unmodified;
+            const auto padded_res     = nstd::from_chars_padded(padded.data(), padded.data() + input.size(), padded_dest, base);
+            CHECK(padded_res.ptr == padded.data() + correct_idx);
+            CHECK(padded_res.ec == correct_ec);
+            CHECK(padded_dest == correct_value.value_or(unmodified));
+
+            if (correct_ec == errc{} && correct_idx == input.size()) {
+                T unchecked = unmodified;
+                nstd::from_chars_unchecked(input.data(), input.data() + input.size(), unchecked, base);
+                CHECK(unchecked == dest);
+            }
+        }
+    }
+}
+
+template <typename T, int... Bases>
+void test_template_base(std::mt19937_64& gen, std::integer_sequence<int, Bases...>) {
+    // to_chars<Base> and from_chars<Base> must agree with the runtime base overloads
+    const auto test_base = [&](auto base_constant) {
+        constexpr int base = decltype(base_constant)::value;
+
+        for (int i = 0; i < 200; ++i) {
+            const T value = random_value<T>(gen);
+
+            check_case = describe_value(value, base);
+
+            array<char, 72> expected{};
+            array<char, 72> actual{};
+            const auto expected_res = nstd::to_chars(expected.data(), expected.data() + expected.size(), value, base);
+            const auto actual_res   = nstd::to_chars<base>(actual.data(), actual.data() + actual.size(), value);
+            CHECK(actual_res.ec == expected_res.ec);
+            CHECK(actual_res.ptr - actual.data() == expected_res.ptr - expected.data());
+            CHECK(actual == expected);
+            CHECK(actual_res.ptr - actual.data() <= nstd::max_chars_v<T, base>);
+
+            T parsed = 0;
+            const auto from_res = nstd::from_chars<base>(actual.data(), actual_res.ptr, parsed);
+            CHECK(from_res.ec == errc{});
+            CHECK(from_res.ptr == actual_res.ptr);
+            CHECK(parsed == value);
+        }
+    };
+
+    (test_base(std::integral_constant<int, Bases + 2>{}), ...);
+}
+
+template <typename T, size_t... Ns>
+void test_fixed(std::mt19937_64& gen, std::index_sequence<Ns...>) {
+    // from_chars_fixed<N> must agree with from_chars on N digits, and reject anything else
+    const auto test_width = [&](auto width_constant) {
+        constexpr size_t width = decltype(width_constant)::value;
+
+        for (int i = 0; i < 500; ++i) {
+            std::vector<char> input(width);
+            for (char& c : input) {
+                c = static_cast<char>('0' + gen() % 10);
+            }
+            const bool valid = gen() % 4 != 0;
+            if (!valid) {
+                input[gen() % width] = static_cast<char>(gen() % 2 == 0 ? '0' + 10 + gen() % 246 : gen() % '0');
+            }
+            check_case = describe_input(input, 10);
+
+            constexpr T unmodified = 111;
+            T dest                 = unmodified;
+            const auto [ptr, ec]   = nstd::from_chars_fixed<width>(input.data(), input.data() + input.size(), dest);
+
+            if (valid) {
+                T expected              = unmodified;
+                const auto expected_res    = nstd::from_chars(input.data(), input.data() + input.size(), expected);
+                CHECK(ptr == expected_res.ptr);
+                CHECK(ec == expected_res.ec);
+                CHECK(dest == expected);
+            } else {
+                CHECK(ptr == input.data());
+                CHECK(ec == errc::invalid_argument);
+                CHECK(dest == unmodified);
+            }
+
+            const auto short_res = nstd::from_chars_fixed<width>(input.data(), input.data() + input.size() - 1, dest);
+            CHECK(short_res.ptr == input.data());
+            CHECK(short_res.ec == errc::invalid_argument);
+        }
+    };
+
+    (test_width(std::integral_constant<size_t, Ns>{}), ...);
+}
+
+void test_chunk_boundaries(std::mt19937_64& gen) {
+    // 32-bit targets split 64-bit values into 9-digit chunks with _Div1e9; a reciprocal that isn't exact rounds the
+    // quotient up for remainders close to 10^9
+    const auto check = [](const uint64_t value) {
+        check_case = describe_value(value, 10);
+        CHECK(nstd::_Div1e9(value) == value / 1'000'000'000U);
+
+        std::array<char, 20> buff{};
+        const auto [ptr, ec] = nstd::to_chars(buff.data(), buff.data() + buff.size(), value);
+        CHECK(ec == errc{});
+        CHECK(std::string(buff.data(), ptr) == reference_to_chars(value, 10));
+    };
+
+    check(12271926450999999999ULL);
+    check(15272537252999999999ULL);
+    check(numeric_limits<uint64_t>::max());
+
+    constexpr uint64_t max_quotient = numeric_limits<uint64_t>::max() / 1'000'000'000U - 1;
+    for (int i = 0; i < 1'000'000; ++i) {
+        const uint64_t quotient = max_quotient - gen() % (max_quotient / (i % 2 == 0 ? 1 : 1000));
+        check(quotient * 1'000'000'000U + 999'999'999U);
+        check(quotient * 1'000'000'000U + 999'999'999U - gen() % 1000);
+    }
+}
+
+template <typename T>
+void test_runtime() {
+    test_integer<T>();
+
+    std::mt19937_64 gen{static_cast<uint64_t>(sizeof(T) * 2 + is_signed_v<T>)};
+    test_random_to_chars<T>(gen);
+    test_random_from_chars<T>(gen);
+    test_template_base<T>(gen, std::make_integer_sequence<int, 35>{});
+    test_fixed<T>(gen, std::index_sequence<1, 2, 3, 4, 7, 8, 9, 15, 16, 17, 19>{});
+}
+
+} // namespace
+
+int main(int, char**) {
+    test_runtime<char>();
+    test_runtime<signed char>();
+    test_runtime<unsigned char>();
+    test_runtime<short>();
+    test_runtime<unsigned short>();
+    test_runtime<int>();
+    test_runtime<unsigned int>();
+    test_runtime<long>();
+    test_runtime<unsigned long>();
+    test_runtime<long long>();
+    test_runtime<unsigned long long>();
+
+    std::mt19937_64 gen{1'000'000'000};
+    test_chunk_boundaries(gen);
+}